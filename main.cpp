@@ -8,7 +8,7 @@ using namespace optimization;
 inline static std::ofstream out("output.txt");
 
 void test(LPP&& lpp, const std::string& method = "simplex", const Variable& var = {}, const Matrix<Fraction>& coefficients = {}) {
-    if (method == "simplex" || method == "dual") {
+    if (method == "simplex" || method == "dual" || method == "revised" || method == "rational" || method == "float") {
         lpp.tabular_optimize(method).get_solutions(method);
     } else if (method.starts_with("Var")) {
         lpp = lpp.standardize();
@@ -33,6 +33,13 @@ void test(LPP&& lpp, const std::string& method = "simplex", const Variable& var
     out << std::string(150, '-') << std::endl;
 }
 
+void test(LPP&& lpp, const Pricing pricing) {
+    ComputationalTable table = lpp.tabular_optimize("simplex");
+    table.pricing = pricing;
+    table.get_solutions();
+    out << std::string(150, '-') << std::endl;
+}
+
 void test(std::vector<Equation>&& equations) {
     basic_feasible_solutions(equations);
     out << std::string(150, '-') << std::endl;
@@ -62,7 +69,21 @@ void test(ComputationalTable&& table, const std::string& method = "simplex", con
     out << std::string(150, '-') << std::endl;
 }
 
-void test(IPP&& ipp, const std::string& path) {
+void test(LPP&& lpp, const std::vector<Fraction>& direction) {
+    lpp.tabular_optimize("simplex").parametric_rhs(direction);
+    out << std::string(150, '-') << std::endl;
+}
+
+void test(LPP&& lpp, const std::map<Variable, Fraction>& direction) {
+    lpp.tabular_optimize("simplex").parametric_cost(direction);
+    out << std::string(150, '-') << std::endl;
+}
+
+void test(IPP&& ipp, const std::string& path, const NodeSelection node_selection = NodeSelection::BREADTH_FIRST, const int threads = 1,
+          const bool deterministic = false) {
+    ipp.node_selection = node_selection;
+    ipp.threads = threads;
+    ipp.deterministic = deterministic;
     auto x = ipp.optimize_branch_bound(path);
     out << std::string(150, '-') << std::endl;
 }
@@ -71,6 +92,7 @@ int main() {
     const Variable x("x"), y("y"), z("z"), x1("x1"), x2("x2"), x3("x3"), x4("x4"), x5("x5"), s1("s1"), s2("s2"), s3("s3");
     linalg::GLOBAL_FORMATTING = {true, &out};
     optimization::GLOBAL_FORMATTING = {true, &out};
+    GLOBAL_RENDERER.asynchronous = true;
 
     test(LPP(Optimization::MAXIMIZE, 2 * x + 7 * y,
              {
@@ -78,42 +100,42 @@ int main() {
                  7 * x + 3 * y <= 21,
              },
              {x >= 0, y >= 0}),
-         "graphical", Variable("outputs/graph1.png"));
+         "graphical", Variable("outputs/graph1.svg"));
     test(LPP(Optimization::MAXIMIZE, 3 * x + 5 * y,
              {
                  4 * x + 3 * y <= 12,
                  5 * x + 4 * y >= 20,
              },
              {x >= 0, y >= 0}),
-         "graphical", Variable("outputs/graph2.png"));
+         "graphical", Variable("outputs/graph2.svg"));
     test(LPP(Optimization::MAXIMIZE, x + 2 * y,
              {
                  3 * x + 2 * y <= 6,
                  2 * x + 5 * y >= 10,
              },
              {x >= 0, y >= 0}),
-         "graphical", Variable("outputs/graph3.png"));
+         "graphical", Variable("outputs/graph3.svg"));
     test(LPP(Optimization::MINIMIZE, 3 * x - 10 * y,
              {
                  5 * x + 2 * y >= 10,
                  4 * x + 3 * y <= 12,
              },
              {x >= 0, y >= 0}),
-         "graphical", Variable("outputs/graph4.png"));
+         "graphical", Variable("outputs/graph4.svg"));
     test(LPP(Optimization::MAXIMIZE, 5 * x + 4 * y,
              {
                  2 * x + 5 * y >= 10,
                  3 * x + 4 * y >= 12,
              },
              {x >= 0, y >= 0}),
-         "graphical", Variable("outputs/graph5.png"));
+         "graphical", Variable("outputs/graph5.svg"));
     test(LPP(Optimization::MINIMIZE, 5 * x + 4 * y,
              {
                  2 * x + 5 * y >= 10,
                  3 * x + 4 * y >= 12,
              },
              {x >= 0, y >= 0}),
-         "graphical", Variable("outputs/graph6.png"));
+         "graphical", Variable("outputs/graph6.svg"));
     test(LPP(Optimization::MAXIMIZE, 10 * x + 4 * y,
              {
                  5 * x + 2 * y <= 100,
@@ -121,7 +143,7 @@ int main() {
                  x + 2 * y <= 50,
              },
              {x >= 0, y >= 0}),
-         "graphical", Variable("outputs/graph7.png"));
+         "graphical", Variable("outputs/graph7.svg"));
     test(LPP(Optimization::MAXIMIZE, 3 * x + 2 * y,
              {
                  x + y <= 4,
@@ -319,6 +341,70 @@ int main() {
              },
              {x1 >= 0, x2 >= 0, x3 >= 0}),
          "dual");
+    // Revised Simplex
+    test(LPP(Optimization::MINIMIZE, x1 - 3 * x2 + 2 * x3,
+             {
+                 3 * x1 - x2 + 2 * x3 <= 7,
+                 -2 * x1 + 4 * x2 <= 12,
+                 -4 * x1 + 3 * x2 + 8 * x3 <= 10,
+             },
+             {x1 >= 0, x2 >= 0, x3 >= 0}),
+         "revised");
+    test(LPP(Optimization::MAXIMIZE, -4 * x - y,
+             {
+                 3 * x + y == 3,
+                 4 * x + 3 * y >= 6,
+                 x + 2 * y <= 3,
+             },
+             {x >= 0, y >= 0}),
+         "revised");
+    test(LPP(Optimization::MAXIMIZE, 3 * x + 2 * y,
+             {
+                 x + y <= 4,
+                 x + 3 * y <= 6,
+             },
+             {x >= 0, y >= 0}),
+         "float");
+    test(LPP(Optimization::MINIMIZE, 2 * x + 3 * y,
+             {
+                 x + y >= 4,
+                 x + 3 * y >= 6,
+             },
+             {x >= 0, y >= 0}),
+         "rational");
+    // Pricing
+    test(LPP(Optimization::MAXIMIZE, 3 * x1 + 5 * x2 + 4 * x3,
+             {
+                 2 * x1 + 3 * x2 <= 8,
+                 2 * x2 + 5 * x3 <= 10,
+                 3 * x1 + 2 * x2 + 4 * x3 <= 15,
+             },
+             {x1 >= 0, x2 >= 0, x3 >= 0}),
+         Pricing::PARTIAL);
+    test(LPP(Optimization::MAXIMIZE, 3 * x1 + 5 * x2 + 4 * x3,
+             {
+                 2 * x1 + 3 * x2 <= 8,
+                 2 * x2 + 5 * x3 <= 10,
+                 3 * x1 + 2 * x2 + 4 * x3 <= 15,
+             },
+             {x1 >= 0, x2 >= 0, x3 >= 0}),
+         Pricing::STEEPEST_EDGE);
+    test(LPP(Optimization::MAXIMIZE, 3 * x1 + 5 * x2 + 4 * x3,
+             {
+                 2 * x1 + 3 * x2 <= 8,
+                 2 * x2 + 5 * x3 <= 10,
+                 3 * x1 + 2 * x2 + 4 * x3 <= 15,
+             },
+             {x1 >= 0, x2 >= 0, x3 >= 0}),
+         Pricing::DEVEX);
+    // Degeneracy
+    test(LPP(Optimization::MAXIMIZE, 3 * x1 / 4 - 20 * x2 + x3 / 2 - 6 * x4,
+             {
+                 x1 / 4 - 8 * x2 - x3 + 9 * x4 <= 0,
+                 x1 / 2 - 12 * x2 - x3 / 2 + 3 * x4 <= 0,
+                 x3 <= 1,
+             },
+             {x1 >= 0, x2 >= 0, x3 >= 0, x4 >= 0}));
     // Alternate Optimal Solution
     test(LPP(Optimization::MAXIMIZE, 2 * x + 4 * y,
              {
@@ -399,6 +485,22 @@ int main() {
              },
              Solution::OPTIMIZED, LPP{Optimization::MAXIMIZE, {}, {x <= 3, x <= 7}, {}}),
          "Var B");
+    // Parametric sweeps
+    test(LPP(Optimization::MAXIMIZE, 2 * x + y,
+             {
+                 3 * x + 5 * y <= 15,
+                 6 * x + 2 * y <= 24,
+             },
+             {x >= 0, y >= 0}),
+         std::vector<Fraction>{0, -1});
+    test(LPP(Optimization::MAXIMIZE, 15 * x + 10 * y,
+             {
+                 4 * x + 6 * y <= 360,
+                 3 * x <= 180,
+                 5 * y <= 200,
+             },
+             {x >= 0, y >= 0}),
+         std::map<Variable, Fraction>{{y, 1}});
     // Addition of new variable
     test(LPP(Optimization::MAXIMIZE, 3 * x + 5 * y,
              {
@@ -568,7 +670,7 @@ int main() {
                  y <= 7,
              },
              {x >= 0, y >= 0}),
-         "outputs/ipp2");
+         "outputs/ipp2", NodeSelection::BEST_FIRST);
     test(IPP(Optimization::MAXIMIZE, 2 * x + 3 * y,
              {
                  6 * x + 5 * y <= 12,
@@ -582,7 +684,7 @@ int main() {
                  3 * x + 11 * y <= 66,
              },
              {x >= 0, y >= 0}),
-         "outputs/ipp4");
+         "outputs/ipp4", NodeSelection::HYBRID);
     test(IPP(Optimization::MINIMIZE, 2 * x + 3 * y,
              {
                  2 * x + 3 * y <= 7,
@@ -591,5 +693,53 @@ int main() {
              },
              {x >= 0, y >= 0}),
          "outputs/ipp5");
+    test(IPP(Optimization::MAXIMIZE, 5 * x1 + 4 * x2 + 3 * x3,
+             {
+                 2 * x1 + 3 * x2 + x3 <= 5,
+                 4 * x1 + x2 + 2 * x3 <= 11,
+                 3 * x1 + 4 * x2 + 2 * x3 <= 8,
+             },
+             {x1 >= 0, x2 >= 0, x3 >= 0}),
+         "");
+    test(IPP(Optimization::MAXIMIZE, 5 * x1 + 4 * x2 + 3 * x3,
+             {
+                 2 * x1 + 3 * x2 + x3 <= 5,
+                 4 * x1 + x2 + 2 * x3 <= 11,
+                 3 * x1 + 4 * x2 + 2 * x3 <= 8,
+             },
+             {x1 >= 0, x2 >= 0, x3 >= 0}),
+         "", NodeSelection::DEPTH_FIRST, 4);
+    test(IPP(Optimization::MAXIMIZE, 5 * x1 + 4 * x2 + 3 * x3,
+             {
+                 2 * x1 + 3 * x2 + x3 <= 5,
+                 4 * x1 + x2 + 2 * x3 <= 11,
+                 3 * x1 + 4 * x2 + 2 * x3 <= 8,
+             },
+             {x1 >= 0, x2 >= 0, x3 >= 0}),
+         "", NodeSelection::DEPTH_FIRST, 4, true);
+
+    // Branch and cut
+    IPP ipp(Optimization::MAXIMIZE, 5 * x1 + 4 * x2 + 3 * x3,
+            {
+                2 * x1 + 3 * x2 + x3 <= 5,
+                4 * x1 + x2 + 2 * x3 <= 11,
+                3 * x1 + 4 * x2 + 2 * x3 <= 8,
+            },
+            {x1 >= 0, x2 >= 0, x3 >= 0});
+    ipp.cut_rounds = 2;
+    ipp.node_cuts = true;
+    test(std::move(ipp), "", NodeSelection::BEST_FIRST);
+
+    // Reliability branching
+    ipp = IPP(Optimization::MAXIMIZE, 5 * x1 + 4 * x2 + 3 * x3,
+              {
+                  2 * x1 + 3 * x2 + x3 <= 5,
+                  4 * x1 + x2 + 2 * x3 <= 11,
+                  3 * x1 + 4 * x2 + 2 * x3 <= 8,
+              },
+              {x1 >= 0, x2 >= 0, x3 >= 0});
+    ipp.branching = Branching::RELIABILITY;
+    test(std::move(ipp), "", NodeSelection::BEST_FIRST);
+    GLOBAL_RENDERER.wait();
     return 0;
 }
@@ -1,22 +1,95 @@
 #pragma once
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <execution>
 #include <filesystem>
+#include <fstream>
 #include <iomanip>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
 #include <queue>
+#include <shared_mutex>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 #include "linear-algebra/linalg.hpp"
 
+#ifndef OPTIMIZATION_TRACING
+#define OPTIMIZATION_TRACING 1 // 0 compiles every trace out
+#endif
+
 namespace optimization {
+    enum class LogLevel : uint8_t { OFF, SUMMARY, ITERATION, TABLEAU };
+
     inline algebra::FormatSettings GLOBAL_FORMATTING;
+    inline LogLevel LOG_LEVEL = LogLevel::TABLEAU;
+    inline thread_local bool LOG_SUPPRESSED = false; // set on branch and bound worker threads
+
+    inline bool is_logging(const LogLevel level) {
+        if constexpr (OPTIMIZATION_TRACING) {
+            return !LOG_SUPPRESSED && level <= LOG_LEVEL;
+        } else {
+            return false;
+        }
+    }
 
     enum class Optimization : bool { MINIMIZE, MAXIMIZE };
     enum class Solution : uint8_t { UNOPTIMIZED, OPTIMIZED, INFEASIBLE, UNBOUNDED, ALTERNATE };
+    enum class Pricing : uint8_t { DANTZIG, PARTIAL, STEEPEST_EDGE, DEVEX };
+    enum class NodeSelection : uint8_t { BREADTH_FIRST, DEPTH_FIRST, BEST_FIRST, HYBRID };
+    enum class Branching : uint8_t { MOST_FRACTIONAL, PSEUDOCOST, RELIABILITY };
+    using Symbol = uint32_t;
+    class SymbolTable;
+    class Integer;
+    class Rational;
+    template <typename T>
+    class Tableau;
+    template <typename T>
+    class SparseMatrix;
+    template <typename T>
+    class BasisFactorization;
+    template <typename T>
+    class CompiledModel;
+    class Renderer;
     class LPP;
     class ComputationalTable;
     class IPP;
 
+    template <typename T>
+    T tolerance() {
+        if constexpr (std::is_floating_point_v<T>) {
+            return 1e-9;
+        } else {
+            return 0;
+        }
+    }
+
     std::vector<std::map<algebra::Variable, algebra::Fraction>> basic_feasible_solutions(const std::vector<algebra::Equation>&);
+
+    template <typename Visitor>
+    void for_each_basic_feasible_solution(const std::vector<algebra::Equation>&, Visitor&&); // without storing them
 } // namespace optimization
 
+#include "src/symbol_table.hpp"
+#include "src/integer.hpp"
+#include "src/rational.hpp"
+#include "src/tableau.hpp"
+#include "src/sparse_matrix.hpp"
+#include "src/basis_factorization.hpp"
+#include "src/compiled_model.hpp"
+#include "src/renderer.hpp"
 #include "src/lpp.hpp"
 #include "src/computation_table.hpp"
 #include "src/ipp.hpp"
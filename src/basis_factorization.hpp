@@ -0,0 +1,125 @@
+#pragma once
+
+template <typename T>
+class optimization::BasisFactorization {
+    struct Eta {
+        int row;
+        std::vector<T> column;
+    };
+
+    int size = 0;
+    std::vector<int> permutation; // LU = PB
+    Tableau<T> lu;
+    std::vector<Eta> etas;
+
+    static T absolute(const T& value) { return value < 0 ? -value : value; }
+
+public:
+    static constexpr int REFACTORIZATION_FREQUENCY = 32;
+
+    BasisFactorization() = default;
+
+    bool factorize(const SparseMatrix<T>& matrix, const std::vector<int>& columns) {
+        size = columns.size();
+        lu = Tableau<T>(size, size, 0);
+        permutation.resize(size);
+        std::iota(permutation.begin(), permutation.end(), 0);
+        etas.clear();
+
+        for (int j = 0; j < size; j++) {
+            const std::span<const int> indices = matrix.indices(columns[j]);
+            const std::span<const T> values = matrix.values(columns[j]);
+            const int non_zeros = indices.size();
+
+            for (int k = 0; k < non_zeros; k++) {
+                lu[indices[k], j] = values[k];
+            }
+        }
+        for (int k = 0; k < size; k++) {
+            int p = k;
+
+            for (int i = k + 1; i < size; i++) {
+                if (absolute(lu[i, k]) > absolute(lu[p, k])) {
+                    p = i;
+                }
+            }
+            if (absolute(lu[p, k]) <= tolerance<T>()) {
+                return false; // singular basis
+            }
+            lu.swap_rows(p, k);
+            std::swap(permutation[p], permutation[k]);
+
+            for (int i = k + 1; i < size; i++) {
+                if (lu[i, k] != 0) {
+                    lu[i, k] /= lu[k, k];
+
+                    for (int j = k + 1; j < size; j++) {
+                        lu[i, j] -= lu[i, k] * lu[k, j];
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    void ftran(std::vector<T>& x) const {
+        std::vector<T> y(size);
+
+        for (int i = 0; i < size; i++) {
+            y[i] = x[permutation[i]];
+
+            for (int j = 0; j < i; j++) {
+                y[i] -= lu[i, j] * y[j];
+            }
+        }
+        for (int i = size - 1; i >= 0; i--) {
+            for (int j = i + 1; j < size; j++) {
+                y[i] -= lu[i, j] * y[j];
+            }
+            y[i] /= lu[i, i];
+        }
+        for (const auto& [row, column] : etas) {
+            if (y[row] != 0) {
+                y[row] /= column[row];
+
+                for (int i = 0; i < size; i++) {
+                    if (i != row) {
+                        y[i] -= column[i] * y[row];
+                    }
+                }
+            }
+        }
+        x = std::move(y);
+    }
+
+    void btran(std::vector<T>& y) const {
+        std::vector<T> w = y;
+
+        for (const auto& [row, column] : etas | std::views::reverse) {
+            for (int i = 0; i < size; i++) {
+                if (i != row) {
+                    w[row] -= w[i] * column[i];
+                }
+            }
+            w[row] /= column[row];
+        }
+        for (int j = 0; j < size; j++) {
+            for (int i = 0; i < j; i++) {
+                w[j] -= w[i] * lu[i, j];
+            }
+            w[j] /= lu[j, j];
+        }
+        for (int j = size - 1; j >= 0; j--) {
+            for (int i = j + 1; i < size; i++) {
+                w[j] -= w[i] * lu[i, j];
+            }
+        }
+        for (int i = 0; i < size; i++) {
+            y[permutation[i]] = w[i];
+        }
+    }
+
+    void update(const int row, const std::vector<T>& column) { etas.emplace_back(row, column); }
+
+    bool is_stale() const { return etas.size() >= REFACTORIZATION_FREQUENCY; }
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+template <typename T>
+class optimization::CompiledModel { // dense row-major constraints over interned variables
+    int rows = 0, columns = 0;
+    std::vector<int> symbol_columns; // symbol -> column, -1 when absent
+    std::vector<T> matrix, rhs, objective;
+    std::vector<int8_t> senses; // -1 for <=, 0 for = and 1 for >=
+
+    int index(const algebra::Variable& variable) {
+        const Symbol symbol = GLOBAL_SYMBOLS.intern(variable);
+
+        if (symbol >= symbol_columns.size()) {
+            symbol_columns.resize(symbol + 1, -1);
+        }
+        return symbol_columns[symbol] != -1 ? symbol_columns[symbol] : symbol_columns[symbol] = columns++;
+    }
+
+    static T dot(std::span<const T> lhs, std::span<const T> rhs) {
+        if constexpr (std::is_floating_point_v<T>) {
+            return std::transform_reduce(std::execution::unseq, lhs.begin(), lhs.end(), rhs.begin(), T());
+        } else {
+            return std::transform_reduce(lhs.begin(), lhs.end(), rhs.begin(), T());
+        }
+    }
+
+    static bool is_satisfied(const T& lhs, const T& rhs, const int8_t sense) {
+        const T difference = lhs - rhs;
+        return sense < 0   ? difference <= tolerance<T>()
+               : sense > 0 ? -difference <= tolerance<T>()
+                           : difference <= tolerance<T>() && -difference <= tolerance<T>();
+    }
+
+public:
+    CompiledModel() = default;
+
+    CompiledModel(const algebra::Polynomial& objective, const std::vector<algebra::Inequation>& constraints) { // skips unrestricted restrictions
+        std::vector<const algebra::Inequation*> compiled;
+
+        for (const algebra::Inequation& constraint : constraints) {
+            if (!(constraint.lhs.is_fraction() && static_cast<algebra::Fraction>(constraint.lhs) == algebra::inf ||
+                  constraint.rhs.is_fraction() && static_cast<algebra::Fraction>(constraint.rhs) == algebra::inf)) {
+                compiled.push_back(&constraint);
+
+                for (const algebra::Variable& variable : constraint.lhs.expression) {
+                    index(variable);
+                }
+            }
+        }
+        for (const algebra::Variable& variable : objective.expression) {
+            index(variable);
+        }
+        rows = compiled.size();
+        matrix.assign(rows * columns, T());
+        this->objective.assign(columns, T());
+        rhs.reserve(rows);
+        senses.reserve(rows);
+
+        for (int i = 0; i < rows; i++) {
+            for (const algebra::Variable& variable : compiled[i]->lhs.expression) {
+                matrix[i * columns + index(variable)] += static_cast<T>(variable.coefficient);
+            }
+            rhs.push_back(static_cast<T>(static_cast<algebra::Fraction>(compiled[i]->rhs)));
+            senses.push_back(compiled[i]->opr == algebra::RelationalOperator::LE ? -1 : compiled[i]->opr == algebra::RelationalOperator::GE ? 1 : 0);
+        }
+        for (const algebra::Variable& variable : objective.expression) {
+            this->objective[index(variable)] += static_cast<T>(variable.coefficient);
+        }
+    }
+
+    int variables() const { return columns; }
+
+    std::vector<T> point(const std::map<algebra::Variable, algebra::Fraction>& values) const { // missing variables are 0
+        std::vector<T> res(columns);
+
+        for (const auto& [variable, value] : values) {
+            if (const Symbol symbol = GLOBAL_SYMBOLS.find(variable); symbol < symbol_columns.size() && symbol_columns[symbol] != -1) {
+                res[symbol_columns[symbol]] = static_cast<T>(value);
+            }
+        }
+        return res;
+    }
+
+    T value(std::span<const T> x) const { return dot(objective, x); }
+
+    bool is_feasible(std::span<const T> x) const {
+        for (int i = 0; i < rows; i++) {
+            if (!is_satisfied(dot(std::span(matrix).subspan(i * columns, columns), x), rhs[i], senses[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<bool> is_feasible(std::span<const T> points, const int count) const { // column-major batch of count points
+        std::vector<bool> res(count, true);
+        std::vector<T> lhs(count);
+
+        for (int i = 0; i < rows; i++) {
+            std::ranges::fill(lhs, T());
+
+            for (int j = 0; j < columns; j++) {
+                if (const T& element = matrix[i * columns + j]; element != T()) {
+                    const T* column = points.data() + j * count;
+
+                    for (int k = 0; k < count; k++) { // contiguous, vectorizes
+                        lhs[k] += element * column[k];
+                    }
+                }
+            }
+            for (int k = 0; k < count; k++) {
+                res[k] = res[k] && is_satisfied(lhs[k], rhs[i], senses[i]);
+            }
+        }
+        return res;
+    }
+};
@@ -1,107 +1,907 @@
 #pragma once
 
 class optimization::ComputationalTable {
-    static algebra::Fraction extract_coefficient_M(const algebra::Polynomial& polynomial) {
-        const auto itr = std::ranges::find(polynomial.expression, LPP::M, &algebra::Variable::basis);
+public:
+    struct Ranging { // parallel arrays in the signs of the model before standardize, absent bounds are -inf or inf
+        std::vector<Symbol> variables; // structural columns
+        std::vector<algebra::Fraction> reduced_costs, cost_lower, cost_upper;
+        std::vector<algebra::Fraction> shadow_prices, rhs_lower, rhs_upper; // one per lpp constraint, empty unless requested
+    };
+
+    struct Sweep { // breakpoints of the optimal value in increasing t
+        std::vector<algebra::Fraction> parameters, values; // t and Z(t)
+        std::vector<algebra::Fraction> slopes; // dZ/dt before the first parameter, then after each
+        Solution below = Solution::UNOPTIMIZED, above = Solution::UNOPTIMIZED; // before the first and past the last parameter
+    };
+
+private:
+    static constexpr int PARTIAL_PRICING_SEGMENTS = 4;
+    static constexpr int STALL_LIMIT = 8; // degenerate pivots before Bland's rule
+
+    int pricing_offset = 0, degenerate_streak = 0;
+    std::vector<int> basis_position; // column -> basis row, -1 when nonbasic
+    std::unordered_map<Symbol, int> symbol_columns; // symbols of this table only
+    std::vector<bool> artificial, slack;
+    std::vector<double> reference_weights; // devex
+    using Cost = std::pair<algebra::Fraction, algebra::Fraction>; // (coefficient of M, constant)
+    std::vector<Cost> costs; // numeric form of cost
+    std::vector<Symbol> units; // initial basic column of each lpp constraint
+
+    static Cost split(const algebra::Variable& variable) {
+        if (variable.variables == LPP::M.variables) {
+            return {variable.coefficient, 0};
+        }
+        return {0, static_cast<algebra::Fraction>(variable)};
+    }
+
+    static algebra::Polynomial to_polynomial(const Cost& value) {
+        algebra::Polynomial res;
+        res += algebra::Variable(value.second);
 
-        if (itr != polynomial.expression.end()) {
-            return itr->coefficient;
+        if (value.first != 0) {
+            res += value.first * LPP::M;
         }
-        return static_cast<algebra::Fraction>(polynomial);
+        return res;
     }
 
     void compute_zj_cj() {
-        const int size = coefficient_matrix[LPP::B].size();
+        const int size = coefficient_matrix.rows(), columns = coefficient_matrix.columns();
         zj_cj.clear();
 
-        for (const algebra::Variable& variable : cost | std::views::keys) {
-            algebra::Polynomial polynomial;
+        for (int j = 1; j < columns; j++) { // B
+            const auto& [M, C] = costs[j];
+            zj_cj.emplace_back(-M, -C);
+        }
+        for (int i = 0; i < size; i++) {
+            const auto& [M, C] = costs[basis_vector[i]];
+
+            if (M == 0 && C == 0) {
+                continue;
+            }
+            for (int j = 1; j < columns; j++) { // B
+                if (const algebra::Fraction& element = coefficient_matrix[i, j]; element != 0) {
+                    if (M != 0) {
+                        zj_cj[j - 1].first += M * element;
+                    }
+                    if (C != 0) {
+                        zj_cj[j - 1].second += C * element;
+                    }
+                }
+            }
+        }
+    }
+
+    Cost reduced_cost(const int column) const { // zj - cj of one column
+        const int size = coefficient_matrix.rows();
+        const auto& [M, C] = costs[column];
+        Cost res(-M, -C);
+
+        for (int i = 0; i < size; i++) {
+            if (const algebra::Fraction& element = coefficient_matrix[i, column]; element != 0) {
+                const auto& [basic_M, basic_C] = costs[basis_vector[i]];
+                res.first += basic_M * element;
+                res.second += basic_C * element;
+            }
+        }
+        return res;
+    }
+
+    bool is_tabulated() const { return coefficient_matrix.columns() == static_cast<int>(variables.size()); }
+
+    void tabulate() {
+        if (is_tabulated()) {
+            return;
+        }
+        const int columns = constraint_matrix.columns();
+        coefficient_matrix = Tableau<algebra::Fraction>(constraint_matrix.rows(), columns, 0);
+
+        for (int j = 0; j < columns; j++) {
+            const std::span<const int> indices = constraint_matrix.indices(j);
+            const std::span<const algebra::Fraction> values = constraint_matrix.values(j);
+            const int size = indices.size();
+
+            for (int k = 0; k < size; k++) {
+                coefficient_matrix[indices[k], j] = values[k];
+            }
+        }
+    }
+
+    int insert_column(const algebra::Variable& variable, const algebra::Variable& value) {
+        const int idx = std::ranges::lower_bound(variables, variable) - variables.begin();
+        const Symbol symbol = GLOBAL_SYMBOLS.intern(variable);
+        const char prefix = variable.variables[0].name[0];
+
+        for (int& column : basis_vector) {
+            if (column >= idx) {
+                column++;
+            }
+        }
+        for (auto& [key, column] : symbol_columns) {
+            if (column >= idx) {
+                column++;
+            }
+        }
+        variables.insert(variables.begin() + idx, variable);
+        cost.insert(cost.begin() + idx, value);
+        symbols.insert(symbols.begin() + idx, symbol);
+        costs.insert(costs.begin() + idx, split(value));
+        artificial.insert(artificial.begin() + idx, prefix == 'A');
+        slack.insert(slack.begin() + idx, prefix == 's');
+        basis_position.insert(basis_position.begin() + idx, -1);
+        symbol_columns[symbol] = idx;
+        coefficient_matrix.insert_column(idx, 0);
+
+        if (!reference_weights.empty()) {
+            reference_weights.insert(reference_weights.begin() + idx, 1);
+        }
+        return idx;
+    }
+
+    void erase_column(const int idx) {
+        for (int& column : basis_vector) {
+            if (column > idx) {
+                column--;
+            }
+        }
+        symbol_columns.erase(symbols[idx]);
+
+        for (auto& [key, column] : symbol_columns) {
+            if (column > idx) {
+                column--;
+            }
+        }
+        variables.erase(variables.begin() + idx);
+        cost.erase(cost.begin() + idx);
+        symbols.erase(symbols.begin() + idx);
+        costs.erase(costs.begin() + idx);
+        artificial.erase(artificial.begin() + idx);
+        slack.erase(slack.begin() + idx);
+        basis_position.erase(basis_position.begin() + idx);
+        coefficient_matrix.erase_column(idx);
+
+        if (!reference_weights.empty()) {
+            reference_weights.erase(reference_weights.begin() + idx);
+        }
+    }
+
+    algebra::Variable next_slack() const {
+        auto range = std::views::iota(1, coefficient_matrix.columns()) |
+            std::views::filter([this](const int column) -> bool { return is_slack(column); }) |
+            std::views::transform([this](const int column) -> int { return std::stoi(variables[column].variables[0].name.substr(1)); }); // B
+        return algebra::Variable("s" + std::to_string(std::ranges::empty(range) ? 1 : *std::ranges::max_element(range) + 1));
+    }
+
+    static algebra::Fraction fractional_part(const algebra::Fraction& value) {
+        const algebra::Fraction res = value - static_cast<int64_t>(value);
+        return res < 0 ? res + 1 : res;
+    }
+
+    void index_columns() { // after building variables, cost and basis_vector
+        const int columns = variables.size();
+        symbols.clear();
+        costs.clear();
+        artificial.clear();
+        slack.clear();
+        symbol_columns.clear();
+
+        for (int j = 0; j < columns; j++) {
+            const Symbol symbol = symbols.emplace_back(GLOBAL_SYMBOLS.intern(variables[j]));
+            const char prefix = variables[j].variables[0].name[0];
+            costs.push_back(j ? split(cost[j]) : Cost()); // B
+            artificial.push_back(prefix == 'A');
+            slack.push_back(prefix == 's');
+            symbol_columns[symbol] = j;
+        }
+        index_basis();
+    }
+
+    void index_basis() { // after replacing basis_vector
+        const int size = basis_vector.size();
+        basis_position.assign(variables.size(), -1);
+
+        for (int i = 0; i < size; i++) {
+            basis_position[basis_vector[i]] = i;
+        }
+    }
+
+    void set_cost(const int column, const algebra::Variable& value) {
+        cost[column] = value;
+        costs[column] = split(value);
+    }
+
+    void set_basis(const int row, const int column) {
+        basis_position[basis_vector[row]] = -1;
+        basis_vector[row] = column;
+        basis_position[column] = row;
+    }
+
+    template <typename Predicate>
+    int scan(const int columns, Predicate&& is_better) { // cyclic from pricing_offset
+        const int count = columns - 1; // B
+        const int segment = pricing == Pricing::PARTIAL ? (count + PARTIAL_PRICING_SEGMENTS - 1) / PARTIAL_PRICING_SEGMENTS : count;
+        int res = 0, k = 0;
+
+        for (; k < count && (k < segment || !res); k++) {
+            const int j = (pricing_offset + k) % count + 1; // B
+
+            if (is_better(j, res)) {
+                res = j;
+            }
+        }
+        if (pricing == Pricing::PARTIAL && count) {
+            pricing_offset = (pricing_offset + k) % count;
+        }
+        return res;
+    }
+
+    int price_block() { // partial pricing on the tableau, reduced costs of the scanned columns only, 0 when none is negative
+        const int columns = coefficient_matrix.columns();
+        zj_cj.resize(columns - 1); // B
+        return scan(columns, [this](const int j, const int best) -> bool {
+            zj_cj[j - 1] = reduced_cost(j);
+            return zj_cj[j - 1] < Cost() && (!best || zj_cj[j - 1] < zj_cj[best - 1]);
+        });
+    }
+
+    void trace(const int row, const int column, const bool tableau = true) const { // row is -1 when unbounded
+        if (tableau && is_logging(LogLevel::TABLEAU)) {
+            GLOBAL_FORMATTING << *this;
+        } else if (row != -1 && is_logging(LogLevel::ITERATION)) {
+            GLOBAL_FORMATTING << "Pivot " << pivots + 1 << ": " << GLOBAL_SYMBOLS.name(symbols[column]) << " enters, "
+                              << GLOBAL_SYMBOLS.name(symbols[basis_vector[row]]) << " leaves" << std::endl;
+        }
+    }
+
+    bool is_stalled() const { return degenerate_streak >= STALL_LIMIT; }
+
+    void record_pivot(const bool is_degenerate) {
+        pivots++;
+
+        if (is_degenerate) {
+            degenerate_pivots++;
+            degenerate_streak++;
+        } else {
+            degenerate_streak = 0;
+        }
+    }
+
+    int price() {
+        const int size = coefficient_matrix.rows(), columns = coefficient_matrix.columns();
+
+        if (is_stalled()) { // Bland's rule: lowest index with a negative reduced cost
+            for (int j = 1; j < columns; j++) { // B
+                if (zj_cj[j - 1] < Cost()) {
+                    return j;
+                }
+            }
+            return 0;
+        }
+        if (pricing == Pricing::DANTZIG || pricing == Pricing::PARTIAL) {
+            return scan(columns, [this](const int j, const int best) -> bool {
+                return zj_cj[j - 1] < Cost() && (!best || zj_cj[j - 1] < zj_cj[best - 1]);
+            });
+        }
+        std::vector<std::pair<double, double>> scores(columns);
+
+        if (pricing == Pricing::DEVEX) {
+            reference_weights.resize(columns, 1);
+        }
+        return scan(columns, [&](const int j, const int best) -> bool {
+            if (zj_cj[j - 1] >= Cost()) {
+                return false;
+            }
+            double weight = 1;
+
+            if (pricing == Pricing::DEVEX) {
+                weight = reference_weights[j];
+            } else {
+                for (int i = 0; i < size; i++) {
+                    if (const algebra::Fraction& element = coefficient_matrix[i, j]; element != 0) {
+                        weight += static_cast<double>(element) * static_cast<double>(element);
+                    }
+                }
+            }
+            const double norm = std::sqrt(weight);
+            scores[j] = {static_cast<double>(zj_cj[j - 1].first) / norm, static_cast<double>(zj_cj[j - 1].second) / norm};
+            return !best || scores[j] < scores[best];
+        });
+    }
+
+    void update_reference_weights(const int row, const int column) { // before pivoting on (row, column)
+        const int columns = coefficient_matrix.columns();
+        reference_weights.resize(columns, 1); // the alternate path pivots without pricing
+        const double pivot = static_cast<double>(coefficient_matrix[row, column]), weight = reference_weights[column];
+
+        for (int j = 1; j < columns; j++) { // B
+            if (const algebra::Fraction& element = coefficient_matrix[row, j]; j != column && element != 0) {
+                const double ratio = static_cast<double>(element) / pivot;
+                reference_weights[j] = std::max(reference_weights[j], ratio * ratio * weight);
+            }
+        }
+        reference_weights[basis_vector[row]] = std::max(weight / (pivot * pivot), 1.0);
+    }
+
+    bool is_preferred(const int row, const int other) const { // artificials leave first
+        const bool artificial = is_artificial(basis_vector[row]);
+
+        if (artificial != is_artificial(basis_vector[other])) {
+            return artificial;
+        }
+        return is_stalled() && basis_vector[row] < basis_vector[other];
+    }
+
+    std::pair<int, algebra::Fraction> slack_row(const int column) const { // -1 for cuts
+        const int constraints = lpp.constraints.size();
+
+        for (int i = 0; i < constraints; i++) {
+            const std::vector<algebra::Variable>& expression = lpp.constraints[i].lhs.expression;
+
+            if (auto itr = std::ranges::find(expression, variables[column], &algebra::Variable::basis); itr != expression.end()) {
+                return {i, itr->coefficient};
+            }
+        }
+        const int i = std::stoi(variables[column].variables[0].name.substr(1)) - 1; // unstandardized lpp
+
+        if (i < constraints && lpp.constraints[i].opr != algebra::RelationalOperator::EQ) {
+            return {i, lpp.constraints[i].opr == algebra::RelationalOperator::GE ? -1 : 1};
+        }
+        return {-1, 1};
+    }
+
+    algebra::Fraction objective_sign() const { return lpp.is_negated ? -1 : 1; }
+
+    algebra::Fraction row_sign(const int row) const { return row < static_cast<int>(lpp.inverted.size()) && lpp.inverted[row] ? -1 : 1; }
+
+    int artificial_row(const int column) const {
+        const int idx = std::ranges::find(units, symbols[column]) - units.begin();
+        return idx < static_cast<int>(units.size()) ? idx : -1;
+    }
+
+    // B^-1 e_i of every lpp constraint i
+    std::vector<std::vector<algebra::Fraction>> inverse_columns() const {
+        const int size = basis_vector.size(), columns = variables.size(), constraints = lpp.constraints.size();
+        std::vector<std::vector<algebra::Fraction>> res(constraints);
+
+        for (int j = 1; j < columns; j++) { // B
+            const auto [row, coefficient] = is_slack(j) ? slack_row(j) : std::pair(is_artificial(j) ? artificial_row(j) : -1, algebra::Fraction(1));
+
+            if (row != -1 && res[row].empty()) {
+                res[row].reserve(size);
+
+                for (int i = 0; i < size; i++) {
+                    res[row].push_back(coefficient_matrix[i, j] / coefficient);
+                }
+            }
+        }
+        if (std::ranges::none_of(res, &std::vector<algebra::Fraction>::empty)) {
+            return res;
+        }
+        SparseMatrix<algebra::Fraction> matrix(size);
+        std::vector<int> basis(size);
+        std::iota(basis.begin(), basis.end(), 0);
+
+        for (const int column : basis_vector) {
+            std::vector<std::pair<int, algebra::Fraction>> entries;
+
+            if (is_artificial(column)) {
+                entries.emplace_back(artificial_row(column), 1);
+            } else {
+                for (int i = 0; i < constraints; i++) {
+                    const std::vector<algebra::Variable>& expression = lpp.constraints[i].lhs.expression;
+
+                    if (auto itr = std::ranges::find(expression, variables[column], &algebra::Variable::basis); itr != expression.end()) {
+                        entries.emplace_back(i, itr->coefficient);
+                    }
+                }
+            }
+            matrix.push_column(entries);
+        }
+        BasisFactorization<algebra::Fraction> factorization;
+
+        if (size != constraints || !factorization.factorize(matrix, basis)) {
+            throw std::logic_error("Equality rows need their artificial column once the lpp no longer describes the table");
+        }
+        for (int i = 0; i < constraints; i++) {
+            if (res[i].empty()) {
+                res[i].assign(size, 0);
+                res[i][i] = 1;
+                factorization.ftran(res[i]);
+            }
+        }
+        return res;
+    }
+
+    algebra::Fraction objective_value(const std::vector<algebra::Fraction>& weights = {}) const { // of the basic values
+        const int size = basis_vector.size();
+        algebra::Fraction res;
+
+        for (int i = 0; i < size; i++) {
+            res += (weights.empty() ? costs[basis_vector[i]].second : weights[i]) * coefficient_matrix[i, 0];
+        }
+        return objective_sign() * res;
+    }
+
+    bool start_sweep(Sweep& sweep) { // solves if needed, false unless optimal
+        if (solution == Solution::UNOPTIMIZED) {
+            optimize_simplex();
+        }
+        sweep.below = sweep.above = solution;
+
+        if (solution != Solution::OPTIMIZED && solution != Solution::ALTERNATE) {
+            return false;
+        }
+        tabulate();
+        compute_zj_cj();
+        return true;
+    }
+
+    static void add_breakpoint(Sweep& sweep, const algebra::Fraction& parameter, const algebra::Fraction& value, const algebra::Fraction& slope) {
+        if (!sweep.parameters.empty() && sweep.parameters.back() == parameter) { // degenerate pivot
+            sweep.values.back() = value;
+            sweep.slopes.back() = slope;
+            return;
+        }
+        sweep.parameters.push_back(parameter);
+        sweep.values.push_back(value);
+        sweep.slopes.push_back(slope);
+    }
+
+    static std::vector<algebra::Fraction> negated(std::vector<algebra::Fraction> values) {
+        for (algebra::Fraction& value : values) {
+            value = -value;
+        }
+        return values;
+    }
+
+    // the halves of a sweep along -direction and direction, each with its slope after every parameter
+    static Sweep join(const Sweep& lower, const Sweep& upper) {
+        const int size = lower.parameters.size();
+        Sweep res;
+        res.below = lower.above;
+        res.above = upper.above;
+        res.slopes.push_back(-lower.slopes.back());
+
+        for (int k = size - 1; k > 0; k--) {
+            res.parameters.push_back(-lower.parameters[k]);
+            res.values.push_back(lower.values[k]);
+            res.slopes.push_back(-lower.slopes[k - 1]);
+        }
+        res.parameters.insert(res.parameters.end(), upper.parameters.begin(), upper.parameters.end());
+        res.values.insert(res.values.end(), upper.values.begin(), upper.values.end());
+        res.slopes.insert(res.slopes.end(), upper.slopes.begin(), upper.slopes.end());
+        return res;
+    }
+
+    static void print_sweep(const Sweep& sweep) {
+        if (!is_logging(LogLevel::SUMMARY)) {
+            return;
+        }
+        const int size = sweep.parameters.size();
+
+        if (sweep.below == Solution::INFEASIBLE) {
+            GLOBAL_FORMATTING << "Infeasible Solution below t=" << sweep.parameters.front() << std::endl;
+        } else if (sweep.below == Solution::UNBOUNDED) {
+            GLOBAL_FORMATTING << "Unbounded Solution below t=" << sweep.parameters.front() << std::endl;
+        } else {
+            GLOBAL_FORMATTING << "dZ/dt=" << sweep.slopes.front() << " below t=" << sweep.parameters.front() << std::endl;
+        }
+        for (int k = 0; k < size; k++) {
+            GLOBAL_FORMATTING << "t=" << sweep.parameters[k] << " Z=" << sweep.values[k] << " dZ/dt=" << sweep.slopes[k + 1] << std::endl;
+        }
+        if (sweep.above == Solution::INFEASIBLE) {
+            GLOBAL_FORMATTING << "Infeasible Solution beyond t=" << sweep.parameters.back() << std::endl;
+        } else if (sweep.above == Solution::UNBOUNDED) {
+            GLOBAL_FORMATTING << "Unbounded Solution beyond t=" << sweep.parameters.back() << std::endl;
+        }
+    }
+
+    // t >= 0 with rates = B^-1 direction, dual simplex steps keep the basis optimal
+    Sweep sweep_rhs(std::vector<algebra::Fraction> rates) {
+        const int size = basis_vector.size(), columns = coefficient_matrix.columns();
+        Sweep res;
+        algebra::Fraction t = 0;
+
+        while (true) {
+            algebra::Fraction slope;
+
+            for (int i = 0; i < size; i++) {
+                slope += costs[basis_vector[i]].second * rates[i];
+            }
+            add_breakpoint(res, t, objective_value(), objective_sign() * slope);
+            int lv = -1;
+            algebra::Fraction step;
+
+            for (int i = 0; i < size; i++) {
+                if (rates[i] < 0) {
+                    const algebra::Fraction ratio = -coefficient_matrix[i, 0] / rates[i];
+
+                    if (lv == -1 || ratio < step || ratio == step && basis_vector[i] < basis_vector[lv]) {
+                        lv = i;
+                        step = ratio;
+                    }
+                }
+            }
+            if (lv == -1) {
+                res.above = Solution::OPTIMIZED;
+                break;
+            }
+            t += step;
+
+            for (int i = 0; i < size; i++) {
+                coefficient_matrix[i, 0] += step * rates[i];
+            }
+            int ev = -1;
+
+            for (int k = 1; k < columns; k++) { // B
+                if (const algebra::Fraction& element = coefficient_matrix[lv, k]; element < 0 && !is_basic(k) && !is_artificial(k) &&
+                    (ev == -1 || zj_cj[k - 1].second / -element < zj_cj[ev - 1].second / -coefficient_matrix[lv, ev])) {
+                    ev = k;
+                }
+            }
+            if (ev == -1) { // the row cannot be restored, no feasible point beyond t
+                add_breakpoint(res, t, objective_value(), 0);
+                res.above = Solution::INFEASIBLE;
+                break;
+            }
+            const algebra::Fraction ratio = rates[lv] / coefficient_matrix[lv, ev];
 
             for (int i = 0; i < size; i++) {
-                polynomial += cost[basis_vector[i]] * coefficient_matrix[variable][i];
+                rates[i] = i == lv ? ratio : rates[i] - coefficient_matrix[i, ev] * ratio;
             }
-            zj_cj.push_back(polynomial - cost[variable]);
+            trace(lv, ev);
+            record_pivot(zj_cj[ev - 1].second == 0); // B
+            set_basis(lv, ev);
+            coefficient_matrix.pivot(lv, ev);
+            compute_zj_cj();
+        }
+        return res;
+    }
+
+    // t >= 0 with deltas added to costs, primal simplex steps keep the basis optimal
+    Sweep sweep_cost(const std::vector<algebra::Fraction>& deltas) {
+        const int size = basis_vector.size(), columns = coefficient_matrix.columns();
+        std::vector<algebra::Fraction> rates(columns), basic_deltas(size);
+        Sweep res;
+        algebra::Fraction t = 0;
+
+        while (true) {
+            for (int i = 0; i < size; i++) {
+                basic_deltas[i] = deltas[basis_vector[i]];
+            }
+            add_breakpoint(res, t, objective_value(), objective_value(basic_deltas));
+
+            for (int k = 1; k < columns; k++) { // B
+                rates[k] = -deltas[k];
+            }
+            for (int i = 0; i < size; i++) {
+                if (basic_deltas[i] != 0) {
+                    for (int k = 1; k < columns; k++) { // B
+                        rates[k] += basic_deltas[i] * coefficient_matrix[i, k];
+                    }
+                }
+            }
+            int ev = -1;
+            algebra::Fraction step;
+
+            for (int k = 1; k < columns; k++) { // B
+                if (rates[k] < 0 && !is_basic(k) && !is_artificial(k)) {
+                    if (const algebra::Fraction ratio = -zj_cj[k - 1].second / rates[k]; ev == -1 || ratio < step) {
+                        ev = k;
+                        step = ratio;
+                    }
+                }
+            }
+            if (ev == -1) {
+                res.above = Solution::OPTIMIZED;
+                break;
+            }
+            t += step;
+
+            for (int j = 1; j < columns; j++) { // B
+                if (deltas[j] != 0) {
+                    set_cost(j, algebra::Variable(costs[j].second + step * deltas[j]));
+                }
+            }
+            int lv = -1;
+
+            for (int i = 0; i < size; i++) {
+                if (const algebra::Fraction& element = coefficient_matrix[i, ev];
+                    element > 0 && (lv == -1 || coefficient_matrix[i, 0] / element < coefficient_matrix[lv, 0] / coefficient_matrix[lv, ev])) {
+                    lv = i;
+                }
+            }
+            if (lv == -1) { // the entering column has no bound, Z is unbounded beyond t
+                add_breakpoint(res, t, objective_value(), 0);
+                res.above = Solution::UNBOUNDED;
+                break;
+            }
+            trace(lv, ev);
+            record_pivot(coefficient_matrix[lv, 0] == 0);
+            set_basis(lv, ev);
+            coefficient_matrix.pivot(lv, ev);
+            compute_zj_cj();
+        }
+        return res;
+    }
+
+    template <typename T>
+    static bool lexicographic_less(const std::pair<T, T>& lhs, const std::pair<T, T>& rhs) {
+        if (lhs.first < rhs.first - tolerance<T>()) {
+            return true;
+        }
+        return lhs.first <= rhs.first + tolerance<T>() && lhs.second < rhs.second - tolerance<T>();
+    }
+
+    template <typename T>
+    Solution revise(const SparseMatrix<T>& matrix, BasisFactorization<T>& factorization) {
+        const int size = matrix.rows(), columns = matrix.columns();
+        std::vector<T> cost_M(columns), cost_C(columns), x;
+        auto refactorize = [&] -> bool {
+            if (!factorization.factorize(matrix, basis_vector)) {
+                return false;
+            }
+            x = matrix.scatter(0);
+            factorization.ftran(x);
+            return true;
+        };
+
+        for (int j = 1; j < columns; j++) { // B
+            const auto& [M, C] = costs[j];
+            cost_M[j] = static_cast<T>(M);
+            cost_C[j] = static_cast<T>(C);
+        }
+        if (!refactorize() || std::ranges::any_of(x, [](const T& value) -> bool { return value < -tolerance<T>(); })) {
+            return Solution::INFEASIBLE; // the starting basis is not primal feasible
+        }
+        degenerate_streak = 0;
+
+        while (true) {
+            std::vector<T> dual_M(size), dual_C(size);
+            std::pair<T, T> min;
+            int lv = -1;
+
+            for (int i = 0; i < size; i++) {
+                dual_M[i] = cost_M[basis_vector[i]];
+                dual_C[i] = cost_C[basis_vector[i]];
+            }
+            factorization.btran(dual_M);
+            factorization.btran(dual_C);
+
+            auto is_candidate = [&](const int j) -> bool {
+                if (is_artificial(j) || is_basic(j)) {
+                    return false;
+                }
+                const std::pair value(matrix.dot(j, dual_M) - cost_M[j], matrix.dot(j, dual_C) - cost_C[j]);
+
+                if (lexicographic_less(value, min)) {
+                    min = value;
+                    return true;
+                }
+                return false;
+            };
+            int ev = 0;
+
+            if (is_stalled()) {
+                for (int j = 1; j < columns && !ev; j++) { // B
+                    ev = is_candidate(j) ? j : 0;
+                }
+            } else {
+                ev = scan(columns, [&](const int j, int) -> bool { return is_candidate(j); });
+            }
+            if (!ev) {
+                return Solution::OPTIMIZED;
+            }
+            std::vector<T> alpha = matrix.scatter(ev);
+            T theta = 0;
+            factorization.ftran(alpha);
+
+            for (int i = 0; i < size; i++) {
+                if (alpha[i] > tolerance<T>()) {
+                    const T ratio = x[i] / alpha[i];
+
+                    if (lv == -1 || ratio < theta - tolerance<T>() || ratio <= theta + tolerance<T>() && is_preferred(i, lv)) {
+                        lv = i;
+                        theta = ratio;
+                    }
+                }
+            }
+            if (lv == -1) {
+                return Solution::UNBOUNDED;
+            }
+            for (int i = 0; i < size; i++) {
+                if (alpha[i] != 0) {
+                    x[i] -= theta * alpha[i];
+                }
+            }
+            x[lv] = theta;
+            trace(lv, ev, false);
+            record_pivot(theta <= tolerance<T>());
+            set_basis(lv, ev);
+            factorization.update(lv, alpha);
+
+            if (factorization.is_stale() && !refactorize()) {
+                return Solution::INFEASIBLE;
+            }
+        }
+    }
+
+    // sum of entries <= rhs, or == rhs, as a new slack row of the optimal tableau, reoptimize with optimize_dual_simplex()
+    void add_row(const std::vector<std::pair<Symbol, algebra::Fraction>>& entries, const algebra::Fraction& rhs, const bool is_equation) {
+        algebra::Fraction lhs;
+        std::get<std::vector<std::map<algebra::Variable, algebra::Fraction>>>(get_solutions()); // optimal basis first
+
+        if (is_logging(LogLevel::TABLEAU)) {
+            GLOBAL_FORMATTING << *this;
+        }
+
+        for (const auto& [symbol, coefficient] : entries) { // nonbasic columns are 0
+            if (const int j = column(symbol); is_basic(j)) {
+                lhs += coefficient * coefficient_matrix[basis_row(j), 0];
+            }
+        }
+        if (is_equation ? lhs == rhs : lhs <= rhs) {
+            return;
+        }
+        const int size = basis_vector.size();
+        const int k = insert_column(next_slack(), 0);
+        coefficient_matrix.push_row(0);
+        coefficient_matrix[size, 0] = rhs;
+        coefficient_matrix[size, k] = 1;
+
+        for (const auto& [symbol, coefficient] : entries) {
+            coefficient_matrix[size, column(symbol)] = coefficient;
+        }
+        for (const auto& [symbol, coefficient] : entries) {
+            if (const int idx = basis_row(column(symbol)); idx != -1) {
+                const int columns = coefficient_matrix.columns();
+
+                for (int j = 0; j < columns; j++) {
+                    coefficient_matrix[size, j] -= coefficient * coefficient_matrix[idx, j];
+                }
+            }
+        }
+        basis_vector.push_back(k);
+        basis_position[k] = size;
+        solution = Solution::UNOPTIMIZED;
+
+        if (is_logging(LogLevel::TABLEAU)) {
+            GLOBAL_FORMATTING << *this;
         }
     }
 
 public:
     LPP lpp;
     Solution solution;
-    std::vector<algebra::Variable> basis_vector;
-    std::map<algebra::Variable, algebra::Variable> cost;
-    std::map<algebra::Variable, std::vector<algebra::Fraction>> coefficient_matrix;
-    std::vector<algebra::Polynomial> zj_cj;
+    Pricing pricing = Pricing::DANTZIG;
+    int pivots = 0, degenerate_pivots = 0;
+    std::vector<algebra::Variable> variables, cost; // sorted by variable, column 0 is LPP::B
+    std::vector<Symbol> symbols; // interned name of each column
+    std::vector<int> basis_vector;
+    SparseMatrix<algebra::Fraction> constraint_matrix; // until the first tableau operation
+    Tableau<algebra::Fraction> coefficient_matrix;
+    std::vector<Cost> zj_cj;
     std::vector<algebra::Fraction> mr;
 
     explicit ComputationalTable(const LPP& lpp) : lpp(lpp), solution(Solution::UNOPTIMIZED) {
         const int size = lpp.constraints.size();
-        linalg::Matrix<algebra::Fraction> unit_matrix = linalg::Matrix<algebra::Fraction>::make_identity(size);
+        std::map<algebra::Variable, algebra::Variable> costs;
+        std::map<algebra::Variable, std::vector<std::pair<int, algebra::Fraction>>> entries;
+        std::vector<algebra::Variable> basis(size);
 
         for (const algebra::Variable& variable : lpp.objective.expression) {
-            cost.emplace(variable.basis(), variable.coefficient);
+            costs.emplace(variable.basis(), variable.coefficient);
         }
-        for (const algebra::Inequation& constraint : lpp.constraints) {
-            for (const algebra::Variable& variable : constraint.lhs.expression) {
-                cost.emplace(variable.basis(), 0);
+        for (int i = 0; i < size; i++) {
+            for (const algebra::Variable& variable : lpp.constraints[i].lhs.expression) {
+                costs.emplace(variable.basis(), 0);
+                entries[variable.basis()].emplace_back(i, variable.coefficient);
             }
-            coefficient_matrix[LPP::B].push_back(static_cast<algebra::Fraction>(constraint.rhs));
-        }
-        for (const algebra::Variable& variable : cost | std::views::keys) {
-            coefficient_matrix.emplace(variable, std::vector<algebra::Fraction>());
         }
-        for (const algebra::Inequation& constraint : lpp.constraints) {
-            for (std::vector<algebra::Fraction>& fractions : coefficient_matrix | std::views::drop(1) | std::views::values) { // B
-                fractions.push_back(0);
-            }
-            for (const algebra::Variable& variable : constraint.lhs.expression) {
-                coefficient_matrix[variable.basis()].back() = variable.coefficient;
+        for (const auto& [variable, elements] : entries) {
+            if (elements.size() == 1 && elements.front().second == 1 && basis[elements.front().first].variables.empty()) {
+                basis[elements.front().first] = variable;
             }
         }
         for (int i = 0, j = 1; i < size; i++) {
-            const auto itr =
-                std::ranges::find_if(coefficient_matrix | std::views::drop(1), // B
-                                     [&unit_matrix, i](const std::pair<algebra::Variable, std::vector<algebra::Fraction>>& element) -> bool {
-                                         return element.second == unit_matrix[i];
-                                     });
-
-            if (itr != coefficient_matrix.end()) {
-                basis_vector.push_back(itr->first);
-            } else {
-                const algebra::Variable variable("A" + std::to_string(j++));
-                coefficient_matrix[variable] = unit_matrix[i];
-                cost.emplace(variable, -LPP::M);
-                basis_vector.push_back(variable);
+            if (basis[i].variables.empty()) {
+                basis[i] = algebra::Variable("A" + std::to_string(j++));
+                costs.emplace(basis[i], -LPP::M);
+                entries[basis[i]].emplace_back(i, 1);
             }
         }
+        std::vector<std::pair<int, algebra::Fraction>> rhs;
+        variables.reserve(costs.size() + 1);
+        cost.reserve(costs.size() + 1);
+        variables.push_back(LPP::B);
+        cost.emplace_back();
+        rhs.reserve(size);
+        constraint_matrix = SparseMatrix<algebra::Fraction>(size);
+
+        for (int i = 0; i < size; i++) {
+            rhs.emplace_back(i, static_cast<algebra::Fraction>(lpp.constraints[i].rhs));
+        }
+        constraint_matrix.push_column(rhs);
+
+        for (const auto& [variable, value] : costs) {
+            variables.push_back(variable);
+            cost.push_back(value);
+            constraint_matrix.push_column(entries[variable]);
+        }
+        for (int i = 0; i < size; i++) {
+            basis_vector.push_back(column(basis[i]));
+        }
+        index_columns();
+
+        for (const int j : basis_vector) {
+            units.push_back(symbols[j]);
+        }
     }
 
     ComputationalTable(const std::map<algebra::Variable, algebra::Variable>& cost, const std::vector<algebra::Variable>& basis_vector,
                        const std::map<algebra::Variable, std::vector<algebra::Fraction>>& coefficient_matrix, const Solution solution,
                        const LPP& lpp = LPP()) :
-        lpp(lpp), solution(solution), basis_vector(basis_vector), cost(cost), coefficient_matrix(coefficient_matrix) {
+        lpp(lpp), solution(solution), coefficient_matrix(coefficient_matrix.at(LPP::B).size(), coefficient_matrix.size(), 0) {
+        for (const auto& [variable, fractions] : coefficient_matrix) {
+            const int size = fractions.size(), j = variables.size();
+            variables.push_back(variable);
+            this->cost.push_back(j == 0 ? algebra::Variable() : cost.at(variable)); // B
+
+            for (int i = 0; i < size; i++) {
+                this->coefficient_matrix[i, j] = fractions[i];
+            }
+        }
+        for (const algebra::Variable& variable : basis_vector) {
+            this->basis_vector.push_back(column(variable));
+        }
+        index_columns();
         compute_zj_cj();
     }
 
+    int column(const algebra::Variable& variable) const {
+        const auto itr = std::ranges::lower_bound(variables, variable);
+        return itr != variables.end() && *itr == variable ? itr - variables.begin() : -1;
+    }
+
+    int column(const Symbol symbol) const {
+        const auto itr = symbol_columns.find(symbol);
+        return itr != symbol_columns.end() ? itr->second : -1;
+    }
+
+    int basis_row(const int column) const { return basis_position[column]; }
+
+    bool is_basic(const int column) const { return basis_position[column] != -1; }
+
+    bool is_artificial(const int column) const { return artificial[column]; }
+
+    bool is_slack(const int column) const { return slack[column]; }
+
     std::variant<std::vector<std::map<algebra::Variable, algebra::Fraction>>, Solution> get_solutions(const std::string& method = "simplex") {
         auto add_solution = [this]() -> std::map<algebra::Variable, algebra::Fraction> {
             std::map<algebra::Variable, algebra::Fraction> res;
-            const int size = basis_vector.size();
+            const int columns = coefficient_matrix.columns();
+            auto is_structural = [this](const int column) -> bool { return !is_slack(column) && !is_artificial(column); };
 
-            for (const algebra::Variable& variable :
-                 cost | std::views::keys | std::views::filter([](const algebra::Variable& var) -> bool { return var.variables[0].name[0] != 's'; })) {
-                const int idx = std::ranges::find(basis_vector, variable) - basis_vector.begin();
-                res[variable] = idx < size ? coefficient_matrix[LPP::B][idx] : 0;
-                res[LPP::Z] += static_cast<algebra::Fraction>(cost[variable]) * res[variable];
+            for (const int j : std::views::iota(1, columns) | std::views::filter(is_structural)) { // B
+                const int idx = basis_row(j);
+                res[variables[j]] = idx != -1 ? coefficient_matrix[idx, 0] : 0;
+                res[LPP::Z] += static_cast<algebra::Fraction>(cost[j]) * res[variables[j]];
             }
             res[LPP::Z] *= lpp.type == Optimization::MINIMIZE ? -1 : 1;
-            GLOBAL_FORMATTING << *this;
+
+            if (is_logging(LogLevel::TABLEAU)) {
+                GLOBAL_FORMATTING << *this;
+            }
             return res;
         };
         bool loop = true;
         std::vector<std::map<algebra::Variable, algebra::Fraction>> res;
 
         while (loop) {
-            solution = method == "simplex" ? optimize_simplex() : optimize_dual_simplex();
+            solution = method == "dual"       ? optimize_dual_simplex()
+                       : method == "revised"  ? optimize_revised_simplex()
+                       : method == "rational" ? optimize_revised_simplex<Rational>()
+                       : method == "float"    ? optimize_revised_simplex<double>()
+                                              : optimize_simplex();
 
             switch (solution) {
             case Solution::OPTIMIZED:
@@ -110,11 +910,15 @@ public:
                 break;
 
             case Solution::INFEASIBLE:
-                GLOBAL_FORMATTING << "Infeasible Solution" << std::endl;
+                if (is_logging(LogLevel::SUMMARY)) {
+                    GLOBAL_FORMATTING << "Infeasible Solution" << std::endl;
+                }
                 return Solution::INFEASIBLE;
 
             case Solution::UNBOUNDED:
-                GLOBAL_FORMATTING << "Unbounded Solution" << std::endl;
+                if (is_logging(LogLevel::SUMMARY)) {
+                    GLOBAL_FORMATTING << "Unbounded Solution" << std::endl;
+                }
                 return Solution::UNBOUNDED;
 
             case Solution::ALTERNATE:
@@ -132,12 +936,18 @@ public:
                 std::unreachable();
             }
         }
+        if (!is_logging(LogLevel::SUMMARY)) {
+            return res;
+        }
         for (const std::map<algebra::Variable, algebra::Fraction>& sol : res) {
             for (const auto& [variable, fraction] : sol) {
                 GLOBAL_FORMATTING << variable << '=' << fraction << " ";
             }
             GLOBAL_FORMATTING << std::endl;
         }
+        if (degenerate_pivots) {
+            GLOBAL_FORMATTING << "Degenerate pivots: " << degenerate_pivots << " of " << pivots << std::endl;
+        }
         return res;
     }
 
@@ -145,169 +955,277 @@ public:
         if (solution != Solution::UNOPTIMIZED && solution != Solution::ALTERNATE) {
             return solution;
         }
-        const int size = coefficient_matrix[LPP::B].size();
-        linalg::Matrix<algebra::Fraction> unit_matrix = linalg::Matrix<algebra::Fraction>::make_identity(size);
+        tabulate();
+        const int size = coefficient_matrix.rows();
+        degenerate_streak = 0;
 
         while (true) {
-            if (solution != Solution::ALTERNATE) {
-                compute_zj_cj();
+            int ev = 0;
 
-                if (std::ranges::all_of(zj_cj,
-                                        [](const algebra::Polynomial& polynomial) -> bool { return extract_coefficient_M(polynomial) >= 0; })) {
-                    solution = std::ranges::contains(basis_vector, 'A',
-                                                     [](const algebra::Variable& variable) -> char { return variable.variables[0].name[0]; })
+            if (solution != Solution::ALTERNATE) {
+                if (pricing == Pricing::PARTIAL && !is_stalled() && !is_logging(LogLevel::TABLEAU)) { // a full scan when none is negative
+                    ev = price_block();
+                } else {
+                    compute_zj_cj();
+                }
+                if (!ev && std::ranges::all_of(zj_cj, [](const Cost& value) -> bool { return value >= Cost(); })) {
+                    solution = std::ranges::any_of(basis_vector, [this](const int column) -> bool { return is_artificial(column); })
                         ? Solution::INFEASIBLE
                         : Solution::OPTIMIZED;
                     const int zj_cj_size = zj_cj.size();
-                    auto itr = std::next(coefficient_matrix.begin()); // B
 
                     for (int i = 0; i < zj_cj_size; i++) {
-                        if (zj_cj[i].is_fraction() && static_cast<algebra::Fraction>(zj_cj[i]) == 0 &&
-                            !std::ranges::contains(basis_vector, itr->first)) {
+                        if (zj_cj[i] == Cost() && !is_basic(i + 1)) { // B
                             solution = Solution::ALTERNATE;
                             break;
                         }
-                        ++itr;
                     }
                     return solution;
                 }
             }
-            auto ev = std::next(coefficient_matrix.begin()); // B
             mr.clear();
 
             if (solution == Solution::ALTERNATE) {
                 const int zj_cj_size = zj_cj.size();
+                ev = 1; // B
 
-                for (int i = 0; i < zj_cj_size; i++) {
-                    if (static_cast<algebra::Fraction>(zj_cj[i]) == 0 && !std::ranges::contains(basis_vector, ev->first)) {
+                for (int i = 0; i < zj_cj_size; i++, ev++) {
+                    if (zj_cj[i] == Cost() && !is_basic(ev)) {
                         solution = Solution::UNOPTIMIZED;
                         break;
                     }
-                    ++ev;
                 }
-            } else {
-                ev = std::next(coefficient_matrix.begin(), std::ranges::min_element(zj_cj, {}, extract_coefficient_M) - zj_cj.begin() + 1); // B
+            } else if (!ev) {
+                ev = price();
             }
             for (int i = 0; i < size; i++) {
-                mr.push_back(ev->second[i] <= 0 ? algebra::inf : coefficient_matrix[LPP::B][i] / ev->second[i]);
+                mr.push_back(coefficient_matrix[i, ev] <= 0 ? algebra::inf : coefficient_matrix[i, 0] / coefficient_matrix[i, ev]);
             }
-            int lv = std::ranges::min_element(mr) - mr.begin();
-            bool is_unbounded = true;
-            GLOBAL_FORMATTING << *this;
+            int lv = -1;
 
-            if (!std::ranges::contains(basis_vector, 'A', [](const algebra::Variable& variable) -> char { return variable.variables[0].name[0]; })) {
-                for (int k = 0; k < size && mr[lv] != algebra::inf; k++) {
-                    std::vector<int> candidates;
-
-                    for (int i = 0; i < size; i++) {
-                        if (mr[i] == mr[lv]) {
-                            candidates.push_back(i);
-                        }
-                    }
-                    if (candidates.size() > 1) {
-                        for (const int candidate : candidates) {
-                            mr[candidate] = coefficient_matrix[basis_vector[k]][candidate] / coefficient_matrix[ev->first][k];
-                        }
-                        lv = std::ranges::min_element(mr) - mr.begin();
-                    } else {
-                        is_unbounded = false;
-                        break;
-                    }
+            for (int i = 0; i < size; i++) {
+                if (mr[i] != algebra::inf && (lv == -1 || mr[i] < mr[lv] || mr[i] == mr[lv] && is_preferred(i, lv))) {
+                    lv = i;
                 }
-            } else {
-                is_unbounded = false;
             }
-            if (is_unbounded || mr[lv] == algebra::inf) {
+            trace(lv, ev);
+
+            if (lv == -1) {
                 return solution = Solution::UNBOUNDED;
             }
-            if (cost[basis_vector[lv]].variables == LPP::M.variables) {
-                coefficient_matrix.erase(basis_vector[lv]);
-                cost.erase(basis_vector[lv]);
-                auto itr = std::ranges::find(lpp.objective.expression, basis_vector[lv], &algebra::Variable::basis);
+            record_pivot(mr[lv] == 0);
 
-                if (itr != lpp.objective.expression.end()) {
-                    lpp.objective.expression.erase(itr);
-                }
+            if (pricing == Pricing::DEVEX) {
+                update_reference_weights(lv, ev);
             }
-            const std::pair pivot = {ev->first, lv};
-            std::map<algebra::Variable, std::vector<algebra::Fraction>> new_coefficient_matrix = coefficient_matrix;
-            basis_vector.erase(basis_vector.begin() + lv);
-            basis_vector.insert(basis_vector.begin() + lv, ev->first);
+            const int column = basis_vector[lv];
+            set_basis(lv, ev);
 
-            for (int i = 0; i < size; i++) {
-                new_coefficient_matrix[basis_vector[i]] = unit_matrix[i];
-            }
-            for (const algebra::Variable& variable : coefficient_matrix | std::views::keys |
-                     std::views::filter([this](const algebra::Variable& element) -> bool { return !std::ranges::contains(basis_vector, element); })) {
-                for (int i = 0; i < size; i++) {
-                    if (i == pivot.second) {
-                        new_coefficient_matrix[variable][i] /= coefficient_matrix[pivot.first][pivot.second];
-                    } else {
-                        new_coefficient_matrix[variable][i] = (coefficient_matrix[variable][i] * coefficient_matrix[pivot.first][pivot.second] -
-                                                               coefficient_matrix[variable][pivot.second] * coefficient_matrix[pivot.first][i]) /
-                            coefficient_matrix[pivot.first][pivot.second];
-                    }
+            if (costs[column].first != 0) {
+                auto itr = std::ranges::find(lpp.objective.expression, variables[column], &algebra::Variable::basis);
+
+                if (itr != lpp.objective.expression.end()) {
+                    lpp.objective.expression.erase(itr);
                 }
+                erase_column(column);
+                ev -= ev > column;
             }
-            coefficient_matrix = std::move(new_coefficient_matrix);
+            coefficient_matrix.pivot(lv, ev);
         }
     }
 
     Solution optimize_dual_simplex() {
         solution = Solution::UNBOUNDED;
-        const int size = coefficient_matrix[LPP::B].size();
-        linalg::Matrix<algebra::Fraction> unit_matrix = linalg::Matrix<algebra::Fraction>::make_identity(size);
+        tabulate();
+        const int size = coefficient_matrix.rows(), columns = coefficient_matrix.columns();
 
         while (true) {
             compute_zj_cj();
+            bool is_feasible = true;
 
-            if (std::ranges::all_of(zj_cj,
-                                    [](const algebra::Polynomial& polynomial) -> bool { return static_cast<algebra::Fraction>(polynomial) >= 0; }) &&
-                std::ranges::all_of(coefficient_matrix[LPP::B], [](const algebra::Fraction& fraction) -> bool { return fraction >= 0; })) {
+            for (int i = 0; i < size && is_feasible; i++) {
+                is_feasible = coefficient_matrix[i, 0] >= 0;
+            }
+            if (is_feasible && std::ranges::all_of(zj_cj, [](const Cost& value) -> bool { return value.second >= 0; })) {
                 return solution = Solution::OPTIMIZED;
             }
-            const int lv = std::ranges::min_element(coefficient_matrix[LPP::B]) - coefficient_matrix[LPP::B].begin();
-            const auto begin = std::next(coefficient_matrix.begin()); // B
-            auto ev = std::ranges::max_element(coefficient_matrix | std::views::drop(1),
-                                               [&](const std::pair<algebra::Variable, std::vector<algebra::Fraction>>& lhs,
-                                                   const std::pair<algebra::Variable, std::vector<algebra::Fraction>>& rhs) -> bool {
-                                                   const algebra::Fraction &lhs_value = lhs.second[lv], rhs_value = rhs.second[lv];
-
-                                                   if (lhs_value >= 0) {
-                                                       return true;
-                                                   }
-                                                   if (rhs_value >= 0) {
-                                                       return false;
-                                                   }
-                                                   const int lhs_idx = std::distance(begin, coefficient_matrix.find(lhs.first));
-                                                   const int rhs_idx = std::distance(begin, coefficient_matrix.find(rhs.first));
-                                                   return static_cast<algebra::Fraction>(zj_cj[lhs_idx]) / lhs_value <
-                                                       static_cast<algebra::Fraction>(zj_cj[rhs_idx]) / rhs_value;
-                                               });
-            assert(ev != coefficient_matrix.end());
-            const std::pair pivot = {ev->first, lv};
-            std::map<algebra::Variable, std::vector<algebra::Fraction>> new_coefficient_matrix = coefficient_matrix;
-            GLOBAL_FORMATTING << *this;
-            basis_vector.erase(basis_vector.begin() + lv);
-            basis_vector.insert(basis_vector.begin() + lv, ev->first);
+            if (is_feasible) { // finish with the primal simplex
+                solution = Solution::UNOPTIMIZED;
+                return optimize_simplex();
+            }
+            int lv = 0;
+
+            for (int i = 1; i < size; i++) {
+                if (coefficient_matrix[i, 0] < coefficient_matrix[lv, 0]) {
+                    lv = i;
+                }
+            }
+            const int ev = *std::ranges::max_element(std::views::iota(1, columns), [&](const int lhs, const int rhs) -> bool { // B
+                const algebra::Fraction &lhs_value = coefficient_matrix[lv, lhs], rhs_value = coefficient_matrix[lv, rhs];
+
+                if (lhs_value >= 0) {
+                    return true;
+                }
+                if (rhs_value >= 0) {
+                    return false;
+                }
+                return zj_cj[lhs - 1].second / lhs_value < zj_cj[rhs - 1].second / rhs_value;
+            });
+
+            if (coefficient_matrix[lv, ev] >= 0) {
+                return solution = Solution::INFEASIBLE; // no column can restore the leaving row
+            }
+            trace(lv, ev);
+            record_pivot(zj_cj[ev - 1].second == 0); // B
+            set_basis(lv, ev);
+            coefficient_matrix.pivot(lv, ev);
+        }
+    }
+
+    // pivots in Exact, the resulting tableau is algebra::Fraction and throws std::overflow_error on entries beyond int64
+    template <typename T = algebra::Fraction, typename Exact = std::conditional_t<std::is_floating_point_v<T>, Rational, T>>
+    Solution optimize_revised_simplex() {
+        if (solution != Solution::UNOPTIMIZED) {
+            return optimize_simplex();
+        }
+        if (is_tabulated()) {
+            constraint_matrix = SparseMatrix(coefficient_matrix);
+        }
+        const int size = constraint_matrix.rows(), columns = constraint_matrix.columns();
+        const std::vector<int> initial_basis = basis_vector;
+        const int initial_pivots = pivots, initial_degenerate_pivots = degenerate_pivots;
+        const SparseMatrix<Exact> matrix(constraint_matrix);
+        BasisFactorization<Exact> factorization;
+        Solution status = Solution::INFEASIBLE;
+
+        if constexpr (!std::is_same_v<T, Exact>) {
+            BasisFactorization<T> approximation;
+            revise(SparseMatrix<T>(constraint_matrix), approximation);
+            pivots = initial_pivots; // only the exact pass is reported
+            degenerate_pivots = initial_degenerate_pivots;
+            status = revise(matrix, factorization); // repairs the floating point basis
+        }
+        auto restore = [&] -> void { // discards a failed attempt and its pivots
+            basis_vector = initial_basis;
+            index_basis();
+            pivots = initial_pivots;
+            degenerate_pivots = initial_degenerate_pivots;
+        };
+        if (status == Solution::INFEASIBLE) {
+            restore();
+            status = revise(matrix, factorization);
+        }
+        if (status == Solution::INFEASIBLE) {
+            restore();
+            return optimize_simplex();
+        }
+        coefficient_matrix = Tableau<algebra::Fraction>(size, columns, 0);
+
+        for (int j = 0; j < columns; j++) {
+            std::vector<Exact> column = matrix.scatter(j);
+            factorization.ftran(column);
 
             for (int i = 0; i < size; i++) {
-                new_coefficient_matrix[basis_vector[i]] = unit_matrix[i];
+                coefficient_matrix[i, j] = static_cast<algebra::Fraction>(column[i]);
             }
-            for (const algebra::Variable& variable : coefficient_matrix | std::views::keys |
-                     std::views::filter([this](const algebra::Variable& element) -> bool { return !std::ranges::contains(basis_vector, element); })) {
-                for (int i = 0; i < size; i++) {
-                    if (i == pivot.second) {
-                        new_coefficient_matrix[variable][i] /= coefficient_matrix[pivot.first][pivot.second];
+        }
+        if (status == Solution::UNBOUNDED) {
+            return solution = status;
+        }
+        for (int j = columns - 1; j > 0; j--) { // B
+            if (is_artificial(j) && !is_basic(j)) {
+                auto itr = std::ranges::find(lpp.objective.expression, variables[j], &algebra::Variable::basis);
+
+                if (itr != lpp.objective.expression.end()) {
+                    lpp.objective.expression.erase(itr);
+                }
+                erase_column(j);
+            }
+        }
+        return optimize_simplex();
+    }
+
+    // empty until solved, rhs ranging needs the B^-1 columns
+    Ranging ranging(const bool rhs = true) {
+        Ranging res;
+
+        if (solution != Solution::OPTIMIZED && solution != Solution::ALTERNATE) {
+            return res;
+        }
+        tabulate();
+        const int size = basis_vector.size(), columns = coefficient_matrix.columns();
+        const algebra::Fraction sign = objective_sign();
+        std::vector<int> positions(columns, -1), structural; // column -> cost index
+
+        for (int j = 1; j < columns; j++) { // B
+            if (!is_slack(j) && !is_artificial(j)) {
+                const algebra::Fraction& reduced_cost = zj_cj[j - 1].second;
+                positions[j] = structural.size();
+                structural.push_back(j);
+                res.variables.push_back(symbols[j]);
+                res.reduced_costs.push_back(sign * reduced_cost);
+                res.cost_lower.push_back(-algebra::inf);
+                res.cost_upper.push_back(is_basic(j) ? algebra::inf : reduced_cost);
+            }
+        }
+        for (int i = 0; i < size; i++) {
+            if (const int p = positions[basis_vector[i]]; p != -1) {
+                for (int k = 1; k < columns; k++) { // B
+                    if (const algebra::Fraction& element = coefficient_matrix[i, k]; element != 0 && !is_basic(k) && !is_artificial(k)) {
+                        const algebra::Fraction ratio = -zj_cj[k - 1].second / element;
+
+                        if (element > 0) {
+                            res.cost_lower[p] = std::max(res.cost_lower[p], ratio);
+                        } else {
+                            res.cost_upper[p] = std::min(res.cost_upper[p], ratio);
+                        }
+                    }
+                }
+            }
+        }
+        for (const int j : structural) {
+            algebra::Fraction &lower = res.cost_lower[positions[j]], &upper = res.cost_upper[positions[j]];
+            lower += costs[j].second;
+            upper += costs[j].second;
+
+            if (sign < 0) {
+                lower = -std::exchange(upper, -lower);
+            }
+        }
+        if (!rhs) {
+            return res;
+        }
+        const std::vector<std::vector<algebra::Fraction>> inverse = inverse_columns();
+        const int constraints = inverse.size();
+        res.shadow_prices.resize(constraints);
+        res.rhs_lower.assign(constraints, -algebra::inf);
+        res.rhs_upper.assign(constraints, algebra::inf);
+
+        for (int q = 0; q < constraints; q++) {
+            const algebra::Fraction rhs = static_cast<algebra::Fraction>(lpp.constraints[q].rhs);
+            algebra::Fraction &lower = res.rhs_lower[q], &upper = res.rhs_upper[q];
+
+            for (int i = 0; i < size; i++) {
+                if (const algebra::Fraction& element = inverse[q][i]; element != 0) {
+                    const algebra::Fraction ratio = -coefficient_matrix[i, 0] / element;
+                    res.shadow_prices[q] += costs[basis_vector[i]].second * element;
+
+                    if (element > 0) {
+                        lower = std::max(lower, ratio);
                     } else {
-                        new_coefficient_matrix[variable][i] = (coefficient_matrix[variable][i] * coefficient_matrix[pivot.first][pivot.second] -
-                                                               coefficient_matrix[variable][pivot.second] * coefficient_matrix[pivot.first][i]) /
-                            coefficient_matrix[pivot.first][pivot.second];
+                        upper = std::min(upper, ratio);
                     }
                 }
             }
-            coefficient_matrix = std::move(new_coefficient_matrix);
+            lower += rhs;
+            upper += rhs;
+            res.shadow_prices[q] *= sign * row_sign(q);
+
+            if (row_sign(q) < 0) {
+                lower = -std::exchange(upper, -lower);
+            }
         }
+        return res;
     }
 
     std::vector<algebra::Interval> cost_variation() {
@@ -316,168 +1234,225 @@ public:
         if (solution == Solution::UNOPTIMIZED) {
             optimize_simplex();
         }
-        for (const auto& [variable, value] : cost | std::views::filter([](const std::pair<algebra::Variable, algebra::Variable>& element) -> bool {
-                                                 return element.first.variables[0].name[0] != 's';
-                                             })) {
-            const auto itr = std::ranges::find(basis_vector, variable);
-            algebra::Variable var("C" + variable.variables[0].name);
-
-            if (itr != basis_vector.end()) {
-                const int idx = itr - basis_vector.begin();
-                int i = 0;
-                algebra::Fraction min = algebra::inf, max = -algebra::inf;
-
-                for (const auto& [name, fractions] : coefficient_matrix | std::views::drop(1)) { // B
-                    if (!std::ranges::contains(basis_vector, name)) {
-                        if (fractions[idx] > 0) {
-                            max = std::max(max, -static_cast<algebra::Fraction>(zj_cj[i] / fractions[idx]));
-                        } else if (fractions[idx] < 0) {
-                            min = std::min(min, -static_cast<algebra::Fraction>(zj_cj[i] / fractions[idx]));
-                        }
-                    }
-                    i++;
-                }
-                res.push_back(max + value < var < min + value);
-            } else {
-                res.push_back(-algebra::inf < var <
-                              zj_cj[std::distance(coefficient_matrix.begin(), coefficient_matrix.find(variable)) - 1] + value); // B
-            }
+        const Ranging ranges = ranging(false);
+        const int size = ranges.variables.size();
+
+        for (int p = 0; p < size; p++) {
+            algebra::Variable var("C" + GLOBAL_SYMBOLS.name(ranges.variables[p]));
+            res.push_back(to_polynomial({0, ranges.cost_lower[p]}) < var < to_polynomial({0, ranges.cost_upper[p]}));
         }
-        for (const algebra::Interval& interval : res) {
-            GLOBAL_FORMATTING << interval << std::endl;
+        if (is_logging(LogLevel::SUMMARY)) {
+            for (const algebra::Interval& interval : res) {
+                GLOBAL_FORMATTING << interval << std::endl;
+            }
         }
         return res;
     }
 
     std::vector<algebra::Interval> RHS_variation() {
-        const int size = basis_vector.size();
-        int i = 0;
+        const Ranging ranges = ranging();
+        const int size = ranges.shadow_prices.size();
         std::vector<algebra::Interval> res;
 
-        for (const auto& [name, fractions] :
-             coefficient_matrix | std::views::filter([](const std::pair<algebra::Variable, std::vector<algebra::Fraction>>& element) -> bool {
-                 return element.first.variables[0].name[0] == 's';
-             })) {
-            algebra::Variable var("B" + std::to_string(i + 1));
-            algebra::Fraction min = algebra::inf, max = -algebra::inf;
+        for (int q = 0; q < size; q++) {
+            algebra::Variable var("B" + std::to_string(q + 1));
+            res.push_back(to_polynomial({0, ranges.rhs_lower[q]}) < var < to_polynomial({0, ranges.rhs_upper[q]}));
+        }
+        if (is_logging(LogLevel::SUMMARY)) {
+            for (const algebra::Interval& interval : res) {
+                GLOBAL_FORMATTING << interval << std::endl;
+            }
+        }
+        return res;
+    }
 
-            for (int j = 0; j < size; j++) {
-                if (fractions[j] > 0) {
-                    max = std::max(max, -coefficient_matrix[LPP::B][j] / fractions[j]);
-                } else if (fractions[j] < 0) {
-                    min = std::min(min, -coefficient_matrix[LPP::B][j] / fractions[j]);
+    // Z(t) for b + t direction over all t, one entry per lpp constraint in the signs of the model before standardize
+    Sweep parametric_rhs(const std::vector<algebra::Fraction>& direction) const {
+        if (direction.size() != lpp.constraints.size()) {
+            throw std::invalid_argument("Direction needs one entry per constraint");
+        }
+        ComputationalTable table = *this;
+        Sweep res;
+
+        if (!table.start_sweep(res)) {
+            return res;
+        }
+        const int size = table.basis_vector.size();
+        const std::vector<std::vector<algebra::Fraction>> inverse = table.inverse_columns();
+        const int constraints = inverse.size();
+        std::vector<algebra::Fraction> rates(size); // B^-1 direction
+
+        for (int q = 0; q < constraints; q++) {
+            if (direction[q] != 0) {
+                const algebra::Fraction delta = table.row_sign(q) * direction[q];
+
+                for (int i = 0; i < size; i++) {
+                    rates[i] += delta * inverse[q][i];
                 }
             }
-            res.push_back(max + lpp.constraints[i].rhs < var < min + lpp.constraints[i].rhs);
-            i++;
         }
-        for (const algebra::Interval& interval : res) {
-            GLOBAL_FORMATTING << interval << std::endl;
+        res = join(ComputationalTable(table).sweep_rhs(negated(rates)), ComputationalTable(table).sweep_rhs(std::move(rates)));
+        print_sweep(res);
+        return res;
+    }
+
+    // Z(t) for c + t direction over all t, in the signs of the model before standardize
+    Sweep parametric_cost(const std::map<algebra::Variable, algebra::Fraction>& direction) const {
+        for (const algebra::Variable& variable : direction | std::views::keys) {
+            if (const int j = column(GLOBAL_SYMBOLS.find(variable)); j <= 0 || is_artificial(j)) {
+                throw std::invalid_argument("Direction variable has no cost in the table");
+            }
+        }
+        ComputationalTable table = *this;
+        Sweep res;
+
+        if (!table.start_sweep(res)) {
+            return res;
+        }
+        std::vector<algebra::Fraction> deltas(table.coefficient_matrix.columns());
+
+        for (const auto& [variable, value] : direction) {
+            deltas[table.column(GLOBAL_SYMBOLS.find(variable))] = table.objective_sign() * value;
         }
+        res = join(ComputationalTable(table).sweep_cost(negated(deltas)), ComputationalTable(table).sweep_cost(deltas));
+        print_sweep(res);
         return res;
     }
 
     void add_variable(const algebra::Variable& variable, const linalg::Matrix<algebra::Fraction>& coefficients) {
+        tabulate();
         int i = 0;
-        const int size = basis_vector.size();
+        const int size = basis_vector.size(), columns = coefficient_matrix.columns();
         linalg::Matrix<algebra::Fraction> res(size, size);
         lpp.objective += variable;
-        GLOBAL_FORMATTING << *this;
 
-        for (const auto& [name, fractions] :
-             coefficient_matrix | std::views::filter([](const std::pair<algebra::Variable, std::vector<algebra::Fraction>>& element) -> bool {
-                 return element.first.variables[0].name[0] == 's';
-             })) {
+        if (is_logging(LogLevel::TABLEAU)) {
+            GLOBAL_FORMATTING << *this;
+        }
+
+        for (const int k : std::views::iota(1, columns) | std::views::filter([this](const int column) -> bool { return is_slack(column); })) { // B
             for (int j = 0; j < size; j++) {
-                res[i, j] = fractions[j];
+                res[i, j] = coefficient_matrix[j, k];
             }
             i++;
         }
         res = coefficients * res;
-        coefficient_matrix[variable.basis()] = res[0];
-        cost[variable.basis()] = variable.coefficient;
+        int j = column(variable.basis());
+
+        if (j == -1) {
+            j = insert_column(variable.basis(), variable.coefficient);
+        } else {
+            set_cost(j, variable.coefficient);
+        }
+        for (int k = 0; k < size; k++) {
+            coefficient_matrix[k, j] = res[0, k];
+        }
         solution = Solution::UNOPTIMIZED;
-        GLOBAL_FORMATTING << *this;
+
+        if (is_logging(LogLevel::TABLEAU)) {
+            GLOBAL_FORMATTING << *this;
+        }
     }
 
     void remove_variable(const algebra::Variable& variable) {
-        GLOBAL_FORMATTING << *this;
+        tabulate();
+        const int j = column(variable);
+
+        if (is_logging(LogLevel::TABLEAU)) {
+            GLOBAL_FORMATTING << *this;
+        }
 
-        if (std::ranges::contains(basis_vector, variable)) {
-            cost[variable.basis()] = -LPP::M;
+        if (is_basic(j)) {
+            set_cost(j, -LPP::M);
             solution = Solution::UNOPTIMIZED;
         } else {
-            const int idx = std::ranges::distance(cost.begin(), cost.find(variable));
-            lpp.objective -= cost[variable] * variable;
-            zj_cj.erase(zj_cj.begin() + idx);
-            cost.erase(variable);
-            coefficient_matrix.erase(variable);
+            lpp.objective -= cost[j] * variable;
+            zj_cj.erase(zj_cj.begin() + j - 1); // B
+            erase_column(j);
+        }
+        if (is_logging(LogLevel::TABLEAU)) {
+            GLOBAL_FORMATTING << *this;
         }
-        GLOBAL_FORMATTING << *this;
     }
 
-    void add_constraint(const algebra::Inequation& inequation) {
-        std::vector<std::pair<std::string, algebra::Fraction>> substituent;
-        const std::map<algebra::Variable, algebra::Fraction> temp =
-            std::get<std::vector<std::map<algebra::Variable, algebra::Fraction>>>(get_solutions())[0];
-        substituent.reserve(cost.size());
-        GLOBAL_FORMATTING << *this;
+    void add_constraint(const algebra::Inequation& constraint) { // reoptimize with optimize_dual_simplex()
+        const algebra::Inequation inequation = constraint.opr == algebra::RelationalOperator::GE ? constraint.invert() : constraint;
+        std::vector<std::pair<Symbol, algebra::Fraction>> entries;
 
-        for (const auto& [key, value] : temp) {
-            substituent.emplace_back(key.variables[0].name, value);
+        for (const algebra::Variable& variable : inequation.lhs.expression) {
+            const Symbol symbol = GLOBAL_SYMBOLS.find(variable);
+
+            if (column(symbol) == -1) {
+                throw std::invalid_argument("Constraint variable has no column in the table");
+            }
+            entries.emplace_back(symbol, variable.coefficient);
         }
-        if (static_cast<bool>(inequation.substitute(substituent))) {
-            return;
+        add_row(entries, static_cast<algebra::Fraction>(inequation.rhs), inequation.opr == algebra::RelationalOperator::EQ);
+    }
+
+    void add_bound(const Symbol symbol, const bool is_upper, const algebra::Fraction& value) { // symbol <= value or symbol >= value
+        if (column(symbol) == -1) {
+            throw std::invalid_argument("Bound variable has no column in the table");
         }
-        auto range = coefficient_matrix | std::views::keys |
-            std::views::filter([](const algebra::Variable& variable) -> bool { return variable.variables[0].name[0] == 's'; }) |
-            std::views::transform([](const algebra::Variable& variable) -> int { return std::stoi(variable.variables[0].name.substr(1)); });
-        const int size = basis_vector.size() + 1;
-        const algebra::Variable slack("s" + std::to_string(*std::ranges::max_element(range) + 1));
-        algebra::Polynomial transformation;
-        substituent.resize(size);
-        coefficient_matrix[LPP::B].push_back(static_cast<algebra::Fraction>(inequation.rhs));
+        add_row({{symbol, algebra::Fraction(is_upper ? 1 : -1)}}, is_upper ? value : -value, false);
+    }
 
-        for (const algebra::Variable& variable : inequation.lhs.expression) {
-            coefficient_matrix[variable.basis()].push_back(variable.coefficient);
+    // Gomory mixed-integer cuts from the most fractional rows, reoptimize with optimize_dual_simplex()
+    int add_gomory_cuts(const int limit) {
+        const int size = basis_vector.size();
+        std::vector<std::pair<algebra::Fraction, int>> rows; // (distance from 1/2, row)
 
-            if (std::ranges::contains(basis_vector, variable.basis())) {
-                transformation += variable;
+        for (int i = 0; i < size; i++) {
+            if (const algebra::Fraction f0 = fractional_part(coefficient_matrix[i, 0]);
+                f0 != 0 && !is_slack(basis_vector[i]) && !is_artificial(basis_vector[i])) {
+                rows.emplace_back(f0 > algebra::Fraction(1, 2) ? f0 - algebra::Fraction(1, 2) : algebra::Fraction(1, 2) - f0, i);
             }
         }
-        for (algebra::Variable& variable : transformation.expression) {
-            const int idx = std::ranges::find(basis_vector, variable.basis()) - basis_vector.begin();
-            const std::string name = "R" + std::to_string(idx + 1);
-            variable = algebra::Variable(variable.coefficient, name);
-            substituent[idx] = {name, 0};
+        std::ranges::sort(rows);
+
+        if (static_cast<int>(rows.size()) > limit) {
+            rows.resize(limit);
         }
-        for (std::vector<algebra::Fraction>& fractions : coefficient_matrix | std::views::values) {
-            if (fractions.size() < size) {
-                fractions.push_back(0);
+        for (const auto& [distance, i] : rows) {
+            const algebra::Fraction f0 = fractional_part(coefficient_matrix[i, 0]);
+            const int row = coefficient_matrix.rows(), k = insert_column(next_slack(), 0), columns = coefficient_matrix.columns();
+            coefficient_matrix.push_row(0);
+            coefficient_matrix[row, 0] = -1;
+            coefficient_matrix[row, k] = 1;
+
+            for (int j = 1; j < columns; j++) { // B, -sum of g_j x_j + s = -1
+                const algebra::Fraction& element = coefficient_matrix[i, j];
+
+                if (j == k || element == 0 || is_basic(j) || is_artificial(j)) {
+                    continue;
+                }
+                if (is_slack(j)) {
+                    coefficient_matrix[row, j] = element > 0 ? -element / f0 : element / (1 - f0);
+                } else {
+                    const algebra::Fraction fj = fractional_part(element);
+                    coefficient_matrix[row, j] = fj <= f0 ? -fj / f0 : -(1 - fj) / (1 - f0);
+                }
             }
+            basis_vector.push_back(k);
+            basis_position[k] = row;
         }
-        basis_vector.push_back(slack);
-        cost.emplace(slack, 0);
-        coefficient_matrix.emplace(slack, std::vector<algebra::Fraction>(size, 0));
-        coefficient_matrix[slack].back() = 1;
+        if (!rows.empty()) {
+            solution = Solution::UNOPTIMIZED;
 
-        for (std::vector<algebra::Fraction>& fractions : coefficient_matrix | std::views::values) {
-            for (int i = 0; i < size - 1; i++) {
-                substituent[i].second = fractions[i];
+            if (is_logging(LogLevel::TABLEAU)) {
+                GLOBAL_FORMATTING << *this;
             }
-            fractions.back() -= static_cast<algebra::Fraction>(transformation.substitute(substituent));
         }
-        solution = Solution::UNOPTIMIZED;
-        GLOBAL_FORMATTING << *this;
+        return rows.size();
     }
 
     friend std::ostream& operator<<(std::ostream& out, const ComputationalTable& computational_table) {
         static constexpr int TAB_SIZE = 13;
-        const int size = computational_table.basis_vector.size(), columns = 3 + computational_table.coefficient_matrix.size();
+        const int size = computational_table.basis_vector.size(), columns = computational_table.coefficient_matrix.columns();
         auto print_partition = [columns, &out] -> void {
             out << std::right << std::setfill('-') << '+';
 
-            for (int i = 0; i < columns; i++) {
+            for (int i = 0; i < 3 + columns; i++) {
                 out << std::setw(TAB_SIZE) << "" << '+';
             }
             out << std::endl << std::left << std::setfill(' ');
@@ -492,8 +1467,8 @@ public:
         for (int i = 0; i < 3; i++) {
             out << std::setw(TAB_SIZE) << "" << ' ';
         }
-        for (const algebra::Variable& variable : computational_table.coefficient_matrix | std::views::drop(1) | std::views::keys) { // B
-            out << format(computational_table.cost.at(variable)) << ' ';
+        for (const algebra::Variable& variable : computational_table.cost | std::views::drop(1)) { // B
+            out << format(variable) << ' ';
         }
         out << std::endl;
         print_partition();
@@ -502,18 +1477,19 @@ public:
         for (const std::string string : {"BV", "C", "B"}) {
             out << format(string) << '|';
         }
-        for (const algebra::Variable& variable : computational_table.coefficient_matrix | std::views::drop(1) | std::views::keys) { // B
+        for (const algebra::Variable& variable : computational_table.variables | std::views::drop(1)) { // B
             out << format(variable.variables[0].name) << '|';
         }
         out << format(std::string("MR")) << '|' << std::endl;
         print_partition();
 
         for (int i = 0; i < size; i++) {
-            out << '|' << format(computational_table.basis_vector[i]) << '|' << std::setw(TAB_SIZE)
-                << format(computational_table.cost.at(computational_table.basis_vector[i])) << '|';
+            const int column = computational_table.basis_vector[i];
+            out << '|' << format(computational_table.variables[column]) << '|' << std::setw(TAB_SIZE) << format(computational_table.cost[column])
+                << '|';
 
-            for (const std::vector<algebra::Fraction>& fractions : computational_table.coefficient_matrix | std::views::values) {
-                out << format(fractions[i]) << '|';
+            for (int j = 0; j < columns; j++) {
+                out << format(computational_table.coefficient_matrix[i, j]) << '|';
             }
             if (!computational_table.mr.empty()) {
                 out << format(computational_table.mr[i] == algebra::inf ? "-ve" : std::to_string(computational_table.mr[i])) << '|';
@@ -530,8 +1506,8 @@ public:
         }
         out << format(std::string("Zj-Cj")) << '|';
 
-        for (const algebra::Polynomial& polynomial : computational_table.zj_cj) {
-            out << format(polynomial) << '|';
+        for (const Cost& value : computational_table.zj_cj) {
+            out << format(to_polynomial(value)) << '|';
         }
         out << std::setw(TAB_SIZE) << "" << '|' << std::endl;
         print_partition();
@@ -541,7 +1517,10 @@ public:
 
 inline optimization::LPP optimization::LPP::dual(const std::string& basis) const {
     LPP canonical = *this;
-    GLOBAL_FORMATTING << canonical;
+
+    if (is_logging(LogLevel::ITERATION)) {
+        GLOBAL_FORMATTING << canonical;
+    }
 
     for (algebra::Inequation& constraint : canonical.constraints) {
         if (type == Optimization::MAXIMIZE && constraint.opr == algebra::RelationalOperator::GE ||
@@ -551,30 +1530,37 @@ inline optimization::LPP optimization::LPP::dual(const std::string& basis) const
     }
     const int objective_size = canonical.objective.expression.size(), constraints_size = canonical.constraints.size();
     LPP res;
-    ComputationalTable computational_table(canonical);
-    std::erase_if(computational_table.coefficient_matrix, [](const std::pair<algebra::Variable, std::vector<algebra::Fraction>>& element) -> bool {
-        return element.first.variables[0].name[0] == 'A';
-    });
-    std::erase_if(computational_table.cost, [](const std::pair<algebra::Variable, algebra::Variable>& element) -> bool {
-        return !element.second.variables.empty() && element.second.variables[0].name == "M";
-    });
+    const ComputationalTable computational_table(canonical);
+    const SparseMatrix<algebra::Fraction>& matrix = computational_table.constraint_matrix;
+    std::vector<int> columns;
+    std::vector<algebra::Variable> variables;
+    auto add_column = [&matrix, &variables](algebra::Polynomial& polynomial, const int column) -> void {
+        const std::span<const int> indices = matrix.indices(column);
+        const std::span<const algebra::Fraction> values = matrix.values(column);
+        const int size = indices.size();
+
+        for (int k = 0; k < size; k++) {
+            polynomial += values[k] * variables[indices[k]];
+        }
+    };
+    std::ranges::copy(std::views::iota(1, matrix.columns()) | std::views::filter([&computational_table](const int column) -> bool { // B
+                          return !computational_table.is_artificial(column);
+                      }),
+                      std::back_inserter(columns));
     res.type = canonical.type == Optimization::MAXIMIZE ? Optimization::MINIMIZE : Optimization::MAXIMIZE;
     res.constraints.resize(objective_size);
     res.restrictions.reserve(constraints_size);
+    variables.reserve(constraints_size);
 
     for (int i = 0; i < constraints_size; i++) {
-        auto itr = std::next(computational_table.coefficient_matrix.begin()); // B
-        algebra::Variable variable(basis + std::to_string(i + 1));
-        res.objective += computational_table.coefficient_matrix[B][i] * variable;
-
-        for (int j = 0; j < objective_size; j++) {
-            res.constraints[j].lhs += itr->second[i] * variable;
-            ++itr;
-        }
+        const algebra::Variable& variable = variables.emplace_back(basis + std::to_string(i + 1));
         res.restrictions.push_back(canonical.constraints[i].opr == algebra::RelationalOperator::EQ ? unrestrict(variable) : variable >= 0);
     }
-    auto itr = computational_table.cost.begin();
+    add_column(res.objective, 0);
 
+    for (int j = 0; j < objective_size; j++) {
+        add_column(res.constraints[j].lhs, columns[j]);
+    }
     for (int i = 0; i < objective_size; i++) {
         res.constraints[i].opr =
             canonical.restrictions[i].lhs.is_fraction() && static_cast<algebra::Fraction>(canonical.restrictions[i].lhs) == algebra::inf ||
@@ -582,15 +1568,16 @@ inline optimization::LPP optimization::LPP::dual(const std::string& basis) const
             ? algebra::RelationalOperator::EQ
             : res.type == Optimization::MAXIMIZE ? algebra::RelationalOperator::LE
                                                  : algebra::RelationalOperator::GE;
-        res.constraints[i].rhs = itr->second;
-        ++itr;
+        res.constraints[i].rhs = computational_table.cost[columns[i]];
+    }
+    if (is_logging(LogLevel::SUMMARY)) {
+        GLOBAL_FORMATTING << "Dual:" << std::endl << res;
     }
-    GLOBAL_FORMATTING << "Dual:" << std::endl << res;
     return res;
 }
 
 inline optimization::ComputationalTable optimization::LPP::tabular_optimize(const std::string& method) const {
-    assert(method == "simplex" || method == "dual");
-    const LPP lpp = method == "simplex" ? standardize() : canonicalize().standardize(true);
+    assert(method == "simplex" || method == "dual" || method == "revised" || method == "rational" || method == "float");
+    const LPP lpp = method == "dual" ? canonicalize().standardize(true) : standardize();
     return ComputationalTable(lpp);
 }
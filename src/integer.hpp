@@ -0,0 +1,330 @@
+#pragma once
+
+class optimization::Integer {
+    using Limbs = std::vector<uint32_t>; // magnitude, least significant limb first
+
+    int64_t value = 0; // never INT64_MIN, only the sign while limbs are allocated
+    std::shared_ptr<const Limbs> limbs;
+
+    static constexpr uint64_t BASE = 1ull << 32;
+
+    bool is_negative() const { return value < 0; }
+
+    Limbs magnitude() const {
+        if (limbs) {
+            return *limbs;
+        }
+        const uint64_t absolute = value < 0 ? -static_cast<uint64_t>(value) : value;
+        Limbs res;
+
+        if (absolute) {
+            res.push_back(static_cast<uint32_t>(absolute));
+        }
+        if (absolute >> 32) {
+            res.push_back(static_cast<uint32_t>(absolute >> 32));
+        }
+        return res;
+    }
+
+    static Integer make(const bool negative, Limbs&& limbs) {
+        while (!limbs.empty() && !limbs.back()) {
+            limbs.pop_back();
+        }
+        Integer res;
+
+        if (limbs.size() <= 2 && (limbs.size() < 2 || limbs[1] < BASE / 2)) {
+            const int64_t absolute = limbs.empty() ? 0 : limbs.size() == 1 ? limbs[0] : static_cast<int64_t>(limbs[1]) << 32 | limbs[0];
+            res.value = negative ? -absolute : absolute;
+        } else {
+            res.value = negative ? -1 : 1;
+            res.limbs = std::make_shared<const Limbs>(std::move(limbs));
+        }
+        return res;
+    }
+
+    static int compare_magnitude(const Limbs& lhs, const Limbs& rhs) {
+        if (lhs.size() != rhs.size()) {
+            return lhs.size() < rhs.size() ? -1 : 1;
+        }
+        for (int i = lhs.size() - 1; i >= 0; i--) {
+            if (lhs[i] != rhs[i]) {
+                return lhs[i] < rhs[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    static Limbs add_magnitude(const Limbs& lhs, const Limbs& rhs) {
+        const Limbs& longer = lhs.size() < rhs.size() ? rhs : lhs;
+        const Limbs& shorter = lhs.size() < rhs.size() ? lhs : rhs;
+        const int size = longer.size(), shorter_size = shorter.size();
+        Limbs res(size + 1);
+        uint64_t carry = 0;
+
+        for (int i = 0; i < size; i++) {
+            carry += static_cast<uint64_t>(longer[i]) + (i < shorter_size ? shorter[i] : 0);
+            res[i] = static_cast<uint32_t>(carry);
+            carry >>= 32;
+        }
+        res.back() = carry;
+        return res;
+    }
+
+    static Limbs subtract_magnitude(const Limbs& lhs, const Limbs& rhs) { // lhs >= rhs
+        const int size = lhs.size(), rhs_size = rhs.size();
+        Limbs res(size);
+        int64_t borrow = 0;
+
+        for (int i = 0; i < size; i++) {
+            const int64_t difference = static_cast<int64_t>(lhs[i]) - (i < rhs_size ? rhs[i] : 0) - borrow;
+            res[i] = static_cast<uint32_t>(difference);
+            borrow = difference < 0;
+        }
+        return res;
+    }
+
+    static Limbs multiply_magnitude(const Limbs& lhs, const Limbs& rhs) {
+        const int lhs_size = lhs.size(), rhs_size = rhs.size();
+        Limbs res(lhs_size + rhs_size);
+
+        for (int i = 0; i < lhs_size; i++) {
+            uint64_t carry = 0;
+
+            for (int j = 0; j < rhs_size; j++) {
+                carry += static_cast<uint64_t>(lhs[i]) * rhs[j] + res[i + j];
+                res[i + j] = static_cast<uint32_t>(carry);
+                carry >>= 32;
+            }
+            res[i + rhs_size] = carry;
+        }
+        return res;
+    }
+
+    static std::pair<Limbs, Limbs> divide_magnitude(const Limbs& lhs, const Limbs& rhs) { // Knuth, algorithm D
+        if (compare_magnitude(lhs, rhs) < 0) {
+            return {{}, lhs};
+        }
+        const int n = rhs.size(), m = lhs.size() - n;
+        Limbs quotient(m + 1);
+
+        if (n == 1) {
+            uint64_t remainder = 0;
+
+            for (int i = m; i >= 0; i--) {
+                remainder = remainder << 32 | lhs[i];
+                quotient[i] = remainder / rhs[0];
+                remainder %= rhs[0];
+            }
+            return {quotient, {static_cast<uint32_t>(remainder)}};
+        }
+        const int shift = std::countl_zero(rhs.back());
+        auto normalize = [shift](const Limbs& limbs, const int size) -> Limbs {
+            const int limb_count = limbs.size();
+            Limbs res(size);
+
+            for (int i = 0; i < limb_count; i++) {
+                res[i] |= limbs[i] << shift;
+
+                if (shift && i + 1 < size) {
+                    res[i + 1] = limbs[i] >> (32 - shift);
+                }
+            }
+            return res;
+        };
+        const Limbs divisor = normalize(rhs, n);
+        Limbs dividend = normalize(lhs, lhs.size() + 1);
+
+        for (int j = m; j >= 0; j--) {
+            const uint64_t numerator = static_cast<uint64_t>(dividend[j + n]) << 32 | dividend[j + n - 1];
+            uint64_t q = numerator / divisor[n - 1], r = numerator % divisor[n - 1];
+
+            while (q >= BASE || q * divisor[n - 2] > (r << 32 | dividend[j + n - 2])) {
+                q--;
+                r += divisor[n - 1];
+
+                if (r >= BASE) {
+                    break;
+                }
+            }
+            int64_t borrow = 0, difference;
+
+            for (int i = 0; i < n; i++) {
+                const uint64_t product = q * divisor[i];
+                difference = dividend[i + j] - borrow - static_cast<int64_t>(product & (BASE - 1));
+                dividend[i + j] = static_cast<uint32_t>(difference);
+                borrow = static_cast<int64_t>(product >> 32) - (difference >> 32);
+            }
+            difference = dividend[j + n] - borrow;
+            dividend[j + n] = static_cast<uint32_t>(difference);
+
+            if (difference < 0) { // added back
+                uint64_t carry = 0;
+                q--;
+
+                for (int i = 0; i < n; i++) {
+                    carry += static_cast<uint64_t>(dividend[i + j]) + divisor[i];
+                    dividend[i + j] = static_cast<uint32_t>(carry);
+                    carry >>= 32;
+                }
+                dividend[j + n] += carry;
+            }
+            quotient[j] = q;
+        }
+        Limbs remainder(n);
+
+        for (int i = 0; i < n; i++) {
+            remainder[i] = dividend[i] >> shift | (shift ? static_cast<uint64_t>(dividend[i + 1]) << (32 - shift) : 0);
+        }
+        return {quotient, remainder};
+    }
+
+    static Integer add(const Integer& lhs, const Integer& rhs, const bool subtract) {
+        const bool lhs_negative = lhs.is_negative(), rhs_negative = rhs.is_negative() != subtract;
+        const Limbs a = lhs.magnitude(), b = rhs.magnitude();
+
+        if (lhs_negative == rhs_negative) {
+            return make(lhs_negative, add_magnitude(a, b));
+        }
+        return compare_magnitude(a, b) >= 0 ? make(lhs_negative, subtract_magnitude(a, b)) : make(rhs_negative, subtract_magnitude(b, a));
+    }
+
+public:
+    Integer(const int64_t value = 0) {
+        if (value == std::numeric_limits<int64_t>::min()) {
+            this->value = -1;
+            limbs = std::make_shared<const Limbs>(Limbs{0, static_cast<uint32_t>(BASE / 2)});
+        } else {
+            this->value = value;
+        }
+    }
+
+    bool is_small() const { return !limbs; }
+
+    int sign() const { return value < 0 ? -1 : value > 0; }
+
+    Integer abs() const { return is_negative() ? -*this : *this; }
+
+    explicit operator int64_t() const { return value; } // requires is_small()
+
+    explicit operator double() const {
+        if (!limbs) {
+            return value;
+        }
+        double res = 0;
+
+        for (int i = limbs->size() - 1; i >= 0; i--) {
+            res = res * BASE + (*limbs)[i];
+        }
+        return value * res;
+    }
+
+    static Integer gcd(Integer lhs, Integer rhs) {
+        lhs = lhs.abs();
+        rhs = rhs.abs();
+
+        while (rhs.sign()) {
+            if (lhs.is_small() && rhs.is_small()) {
+                return std::gcd(lhs.value, rhs.value);
+            }
+            lhs = std::exchange(rhs, lhs % rhs);
+        }
+        return lhs;
+    }
+
+    Integer operator-() const {
+        Integer res = *this;
+        res.value = -value;
+        return res;
+    }
+
+    friend Integer operator+(const Integer& lhs, const Integer& rhs) {
+        int64_t res;
+
+        if (lhs.is_small() && rhs.is_small() && !__builtin_add_overflow(lhs.value, rhs.value, &res)) {
+            return res;
+        }
+        return add(lhs, rhs, false);
+    }
+
+    friend Integer operator-(const Integer& lhs, const Integer& rhs) {
+        int64_t res;
+
+        if (lhs.is_small() && rhs.is_small() && !__builtin_sub_overflow(lhs.value, rhs.value, &res)) {
+            return res;
+        }
+        return add(lhs, rhs, true);
+    }
+
+    friend Integer operator*(const Integer& lhs, const Integer& rhs) {
+        int64_t res;
+
+        if (lhs.is_small() && rhs.is_small() && !__builtin_mul_overflow(lhs.value, rhs.value, &res)) {
+            return res;
+        }
+        return make(lhs.is_negative() != rhs.is_negative(), multiply_magnitude(lhs.magnitude(), rhs.magnitude()));
+    }
+
+    friend Integer operator/(const Integer& lhs, const Integer& rhs) { // truncated, as for built-in integers
+        if (lhs.is_small() && rhs.is_small()) {
+            return lhs.value / rhs.value;
+        }
+        return make(lhs.is_negative() != rhs.is_negative(), std::move(divide_magnitude(lhs.magnitude(), rhs.magnitude()).first));
+    }
+
+    friend Integer operator%(const Integer& lhs, const Integer& rhs) {
+        if (lhs.is_small() && rhs.is_small()) {
+            return lhs.value % rhs.value;
+        }
+        return make(lhs.is_negative(), std::move(divide_magnitude(lhs.magnitude(), rhs.magnitude()).second));
+    }
+
+    Integer& operator+=(const Integer& other) { return *this = *this + other; }
+
+    Integer& operator-=(const Integer& other) { return *this = *this - other; }
+
+    Integer& operator*=(const Integer& other) { return *this = *this * other; }
+
+    Integer& operator/=(const Integer& other) { return *this = *this / other; }
+
+    friend bool operator==(const Integer& lhs, const Integer& rhs) {
+        if (lhs.is_small() || rhs.is_small()) {
+            return lhs.is_small() && rhs.is_small() && lhs.value == rhs.value;
+        }
+        return lhs.value == rhs.value && *lhs.limbs == *rhs.limbs;
+    }
+
+    friend std::strong_ordering operator<=>(const Integer& lhs, const Integer& rhs) {
+        if (lhs.is_small() && rhs.is_small()) {
+            return lhs.value <=> rhs.value;
+        }
+        if (lhs.is_negative() != rhs.is_negative()) {
+            return rhs.is_negative() <=> lhs.is_negative();
+        }
+        const int res = compare_magnitude(lhs.magnitude(), rhs.magnitude());
+        return lhs.is_negative() ? 0 <=> res : res <=> 0;
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, const Integer& integer) {
+        if (integer.is_small()) {
+            return out << integer.value;
+        }
+        Limbs limbs = *integer.limbs;
+        std::vector<uint32_t> digits; // base 10^9, least significant first
+
+        while (!limbs.empty()) {
+            auto [quotient, remainder] = divide_magnitude(limbs, {1'000'000'000});
+            digits.push_back(remainder.empty() ? 0 : remainder[0]);
+
+            while (!quotient.empty() && !quotient.back()) {
+                quotient.pop_back();
+            }
+            limbs = std::move(quotient);
+        }
+        out << (integer.value < 0 ? "-" : "") << digits.back();
+
+        for (int i = digits.size() - 2; i >= 0; i--) {
+            out << std::setw(9) << std::setfill('0') << digits[i];
+        }
+        return out << std::setfill(' ');
+    }
+};
@@ -1,54 +1,816 @@
 #pragma once
 
 class optimization::IPP : public LPP {
+    static constexpr int TABLE_CACHE_SIZE = 64; // parent tableaus kept for warm starts
+    static constexpr int CUTS_PER_ROUND = 8;
+    static constexpr int DIVE_DEPTH = 32, PUMP_ITERATIONS = 16, PUMP_FLIPS = 2;
+    static constexpr int STRONG_CANDIDATES = 8; // lookaheads per node
+    static constexpr double MINIMUM_GAIN = 1e-6; // floor of each gain in the product score
+    using Clock = std::chrono::steady_clock;
+
+    struct Node { // one bound change, the bounds of a node are the changes along its parent chain
+        int parent; // -1 at the root
+        Symbol variable;
+        bool is_upper; // variable <= value, otherwise variable >= value
+        int64_t value;
+        algebra::Fraction bound; // LP value of the parent relaxation
+        double distance; // bound change, for pseudocosts
+    };
+
+    class Pseudocosts { // mean degradation per unit of bound change
+        mutable std::mutex mutex; // shared by parallel workers
+        std::unordered_map<Symbol, std::array<std::pair<double, int>, 2>> statistics; // symbol -> [down, up] -> (sum, count)
+
+        double mean(const Symbol symbol, const bool is_down) const { // of all symbols when this one has none
+            if (const auto itr = statistics.find(symbol); itr != statistics.end() && itr->second[!is_down].second) {
+                return itr->second[!is_down].first / itr->second[!is_down].second;
+            }
+            double sum = 0;
+            int count = 0;
+
+            for (const auto& [key, directions] : statistics) {
+                if (directions[!is_down].second) {
+                    sum += directions[!is_down].first / directions[!is_down].second;
+                    count++;
+                }
+            }
+            return count ? sum / count : 1;
+        }
+
+    public:
+        void update(const Symbol symbol, const bool is_down, const double degradation) {
+            std::lock_guard lock(mutex);
+            auto& [sum, count] = statistics[symbol][!is_down];
+            sum += degradation;
+            count++;
+        }
+
+        bool is_reliable(const Symbol symbol, const int reliability) const {
+            std::lock_guard lock(mutex);
+            const auto itr = statistics.find(symbol);
+            return itr != statistics.end() && std::min(itr->second[0].second, itr->second[1].second) >= reliability;
+        }
+
+        double score(const Symbol symbol, const double fraction) const { // product of down and up degradations
+            std::lock_guard lock(mutex);
+            return std::max(mean(symbol, true) * fraction, MINIMUM_GAIN) * std::max(mean(symbol, false) * (1 - fraction), MINIMUM_GAIN);
+        }
+    };
+
+    struct Incumbent {
+        algebra::Fraction value;
+        std::map<algebra::Variable, algebra::Fraction> solution;
+        const char* source; // "rounding", "diving", "pump" or "node"
+        double time = 0; // milliseconds since the search started
+    };
+
+    using Tables = std::unordered_map<int, std::pair<std::shared_ptr<const ComputationalTable>, int>>; // node -> (tableau, children left)
+
+    bool is_better(const algebra::Fraction& lhs, const algebra::Fraction& rhs) const {
+        return type == Optimization::MAXIMIZE ? lhs > rhs : lhs < rhs;
+    }
+
+    static algebra::Inequation branch(const Node& node) {
+        const algebra::Variable variable(GLOBAL_SYMBOLS.name(node.variable));
+        return node.is_upper ? variable <= node.value : variable >= node.value;
+    }
+
+    IPP rebuild(const std::vector<Node>& nodes, int id) const {
+        IPP res = *this;
+        const int size = constraints.size();
+
+        for (; nodes[id].parent != -1; id = nodes[id].parent) {
+            res.constraints.insert(res.constraints.begin() + size, branch(nodes[id])); // root first
+        }
+        return res;
+    }
+
+    static std::shared_ptr<const ComputationalTable> take_table(Tables& tables, const int parent) {
+        const auto itr = tables.find(parent);
+
+        if (itr == tables.end()) {
+            return nullptr;
+        }
+        std::shared_ptr<const ComputationalTable> res = itr->second.first;
+
+        if (--itr->second.second == 0) {
+            tables.erase(itr);
+        }
+        return res;
+    }
+
+    static void cache_table(Tables& tables, const int id, std::shared_ptr<ComputationalTable>&& table) {
+        if (table && tables.size() < TABLE_CACHE_SIZE) {
+            tables.emplace(id, std::pair{std::move(table), 2});
+        }
+    }
+
+    std::variant<std::map<algebra::Variable, algebra::Fraction>, Solution> relax(ComputationalTable& table, const std::string& method) const {
+        std::variant<std::vector<std::map<algebra::Variable, algebra::Fraction>>, Solution> result = table.get_solutions(method);
+
+        if (const Solution* solution = std::get_if<Solution>(&result)) {
+            return *solution;
+        }
+        std::map<algebra::Variable, algebra::Fraction> res = std::get<std::vector<std::map<algebra::Variable, algebra::Fraction>>>(result).front();
+
+        if (type == Optimization::MINIMIZE) {
+            res[Z] *= -1; // the standard form maximizes the negated objective
+        }
+        return res;
+    }
+
+    // warm started from the parent's tableau, else solves model; table receives the optimal tableau
+    // cuts stay in the tableau, so warm started descendants inherit them
+    std::variant<std::map<algebra::Variable, algebra::Fraction>, Solution> solve(const Node& node,
+                                                                                 const std::shared_ptr<const ComputationalTable>& parent_table,
+                                                                                 const IPP& model, std::shared_ptr<ComputationalTable>& table) const {
+        std::variant<std::map<algebra::Variable, algebra::Fraction>, Solution> res;
+
+        if (parent_table) {
+            table = std::make_shared<ComputationalTable>(*parent_table);
+            table->add_bound(node.variable, node.is_upper, algebra::Fraction(node.value));
+            res = relax(*table, "dual");
+        } else {
+            table = std::make_shared<ComputationalTable>(model.tabular_optimize());
+            res = relax(*table, "simplex");
+        }
+        const int rounds = node.parent == -1 || node_cuts ? cut_rounds : 0;
+
+        for (int k = 0; k < rounds; k++) {
+            const std::map<algebra::Variable, algebra::Fraction>* ans = std::get_if<std::map<algebra::Variable, algebra::Fraction>>(&res);
+
+            if (!ans || is_integral(*ans) || !table->add_gomory_cuts(CUTS_PER_ROUND)) {
+                break;
+            }
+            res = relax(*table, "dual");
+        }
+        return res;
+    }
+
+    static int64_t floor(const algebra::Fraction& value) {
+        const int64_t res = static_cast<int64_t>(value);
+        return algebra::Fraction(res) > value ? res - 1 : res;
+    }
+
+    static std::map<algebra::Variable, algebra::Fraction> round(const std::map<algebra::Variable, algebra::Fraction>& point) { // structural only
+        std::map<algebra::Variable, algebra::Fraction> res;
+
+        for (const auto& [variable, value] : point) {
+            if (is_structural(variable)) {
+                res.emplace(variable, floor(value + algebra::Fraction(1, 2)));
+            }
+        }
+        return res;
+    }
+
+    // adds Z when feasible
+    static std::optional<std::map<algebra::Variable, algebra::Fraction>> evaluate(const CompiledModel<algebra::Fraction>& compiled,
+                                                                                  std::map<algebra::Variable, algebra::Fraction> point) {
+        const std::vector<algebra::Fraction> x = compiled.point(point);
+
+        if (!compiled.is_feasible(x)) {
+            return std::nullopt;
+        }
+        point[Z] = compiled.value(x);
+        return point;
+    }
+
+    // nearest, down and up rounding checked as one batch
+    static std::optional<std::map<algebra::Variable, algebra::Fraction>> round_best(const CompiledModel<algebra::Fraction>& compiled,
+                                                                                    const std::map<algebra::Variable, algebra::Fraction>& relaxation,
+                                                                                    const bool is_maximize) {
+        static constexpr int COUNT = 3;
+        const int columns = compiled.variables();
+        std::array<std::map<algebra::Variable, algebra::Fraction>, COUNT> roundings;
+        roundings.fill(round(relaxation));
+        std::vector<algebra::Fraction> points(columns * COUNT), values(COUNT);
+        std::optional<std::map<algebra::Variable, algebra::Fraction>> res;
+
+        for (auto& [variable, value] : roundings[1]) {
+            value = floor(relaxation.at(variable));
+        }
+        for (auto& [variable, value] : roundings[2]) {
+            value = -floor(-relaxation.at(variable));
+        }
+        for (int k = 0; k < COUNT; k++) {
+            const std::vector<algebra::Fraction> x = compiled.point(roundings[k]);
+            values[k] = compiled.value(x);
+
+            for (int j = 0; j < columns; j++) {
+                points[j * COUNT + k] = x[j];
+            }
+        }
+        const std::vector<bool> is_feasible = compiled.is_feasible(points, COUNT);
+
+        for (int k = 0; k < COUNT; k++) {
+            if (is_feasible[k] && (!res || (is_maximize ? values[k] > res->at(Z) : values[k] < res->at(Z)))) {
+                res = std::move(roundings[k]);
+                (*res)[Z] = values[k];
+            }
+        }
+        return res;
+    }
+
+    // fixes the least fractional variable until integral, without backtracking
+    std::optional<std::map<algebra::Variable, algebra::Fraction>> dive(ComputationalTable table,
+                                                                       std::map<algebra::Variable, algebra::Fraction> relaxation) const {
+        for (int depth = 0; depth < DIVE_DEPTH; depth++) {
+            std::optional<std::pair<algebra::Variable, algebra::Fraction>> fixed;
+            algebra::Fraction distance = 1;
+
+            for (const auto& [variable, value] : round(relaxation)) {
+                if (const algebra::Fraction gap = value > relaxation[variable] ? value - relaxation[variable] : relaxation[variable] - value;
+                    gap != 0 && gap < distance) {
+                    fixed = {variable, value};
+                    distance = gap;
+                }
+            }
+            if (!fixed) {
+                return relaxation;
+            }
+            const auto& [variable, value] = *fixed;
+            table.add_bound(GLOBAL_SYMBOLS.find(variable), value < relaxation[variable], value);
+            std::variant<std::map<algebra::Variable, algebra::Fraction>, Solution> result = relax(table, "dual");
+
+            if (!std::holds_alternative<std::map<algebra::Variable, algebra::Fraction>>(result)) {
+                return std::nullopt;
+            }
+            relaxation = std::get<std::map<algebra::Variable, algebra::Fraction>>(std::move(result));
+        }
+        return std::nullopt;
+    }
+
+    // alternates rounding with the nearest LP point, flipping variables when it cycles
+    std::optional<std::map<algebra::Variable, algebra::Fraction>>
+    feasibility_pump(const CompiledModel<algebra::Fraction>& compiled, const std::map<algebra::Variable, algebra::Fraction>& relaxation) const {
+        std::map<algebra::Variable, algebra::Fraction> target = round(relaxation);
+
+        for (int k = 0; k < PUMP_ITERATIONS; k++) {
+            if (std::optional<std::map<algebra::Variable, algebra::Fraction>> res = evaluate(compiled, target)) {
+                return res;
+            }
+            IPP pump = *this;
+            pump.type = Optimization::MINIMIZE;
+            pump.objective = algebra::Polynomial();
+
+            for (const auto& [variable, value] : target) {
+                const algebra::Variable distance("d" + variable.variables[0].name);
+                pump.objective += distance;
+                pump.constraints.push_back(distance - variable >= -value);
+                pump.constraints.push_back(distance + variable >= value);
+                pump.restrictions.push_back(distance >= 0);
+            }
+            ComputationalTable table = pump.tabular_optimize();
+            std::variant<std::vector<std::map<algebra::Variable, algebra::Fraction>>, Solution> result = table.get_solutions();
+
+            if (!std::holds_alternative<std::vector<std::map<algebra::Variable, algebra::Fraction>>>(result)) {
+                return std::nullopt;
+            }
+            std::map<algebra::Variable, algebra::Fraction>& point =
+                std::get<std::vector<std::map<algebra::Variable, algebra::Fraction>>>(result).front();
+            std::map<algebra::Variable, algebra::Fraction> next = target;
+
+            for (auto& [variable, value] : next) {
+                value = floor(point[variable] + algebra::Fraction(1, 2));
+            }
+            if (next == target) {
+                std::vector<std::pair<algebra::Fraction, algebra::Variable>> gaps;
+
+                for (const auto& [variable, value] : target) {
+                    if (point[variable] != value) {
+                        gaps.emplace_back(point[variable] > value ? point[variable] - value : value - point[variable], variable);
+                    }
+                }
+                std::ranges::sort(gaps, [](const std::pair<algebra::Fraction, algebra::Variable>& lhs,
+                                           const std::pair<algebra::Fraction, algebra::Variable>& rhs) -> bool { return lhs.first > rhs.first; });
+
+                for (int j = 0; j < std::min<int>(PUMP_FLIPS, gaps.size()); j++) {
+                    const algebra::Variable& variable = gaps[j].second;
+                    next[variable] += point[variable] > target[variable] ? 1 : -1;
+                }
+            }
+            target = std::move(next);
+        }
+        return std::nullopt;
+    }
+
+    // solutions hold no slacks or artificials
+    static bool is_structural(const algebra::Variable& variable) { return variable.variables != Z.variables; }
+
+    static bool is_integral(const std::map<algebra::Variable, algebra::Fraction>& solution) {
+        return std::ranges::all_of(solution, [](const std::pair<const algebra::Variable, algebra::Fraction>& element) -> bool {
+            return !is_structural(element.first) || element.second.denominator == 1;
+        });
+    }
+
+    void observe(Pseudocosts& pseudocosts, const Node& node, const algebra::Fraction& value) const { // after solving a child
+        if (node.parent != -1) {
+            const algebra::Fraction change = node.bound > value ? node.bound - value : value - node.bound;
+            pseudocosts.update(node.variable, node.is_upper, static_cast<double>(change) / node.distance);
+        }
+    }
+
+    // solves both children on copies of the node tableau as pseudocost observations
+    void look_ahead(Pseudocosts& pseudocosts, const ComputationalTable& table, const Symbol symbol, const algebra::Fraction& value,
+                    const algebra::Fraction& bound) const {
+        for (const Node& child : children(-1, symbol, value, bound)) {
+            ComputationalTable copy = table;
+            copy.add_bound(child.variable, child.is_upper, algebra::Fraction(child.value));
+            const std::variant<std::map<algebra::Variable, algebra::Fraction>, Solution> result = relax(copy, "dual");
+
+            if (const std::map<algebra::Variable, algebra::Fraction>* ans = std::get_if<std::map<algebra::Variable, algebra::Fraction>>(&result)) {
+                observe(pseudocosts, {0, symbol, child.is_upper, child.value, bound, child.distance}, ans->at(Z));
+            }
+        }
+    }
+
+    // candidates come from the basic structural columns of table, from solution only without one
+    std::pair<Symbol, algebra::Fraction> select_branch(const std::map<algebra::Variable, algebra::Fraction>& solution,
+                                                       const ComputationalTable* table, Pseudocosts& pseudocosts) const { // solution is not integral
+        std::vector<std::pair<double, std::pair<Symbol, algebra::Fraction>>> candidates; // (distance to an integer, candidate)
+        auto consider = [&candidates](const Symbol symbol, const algebra::Fraction& value) -> void {
+            if (value.denominator != 1) {
+                const double fraction = static_cast<double>(value - floor(value));
+                candidates.emplace_back(std::min(fraction, 1 - fraction), std::pair{symbol, value});
+            }
+        };
+
+        if (table) {
+            const int columns = table->coefficient_matrix.columns();
+
+            for (int j = 1; j < columns; j++) { // columns are in variable order, as solution is
+                if (const int row = table->basis_row(j); row != -1 && !table->is_slack(j) && !table->is_artificial(j)) {
+                    consider(table->symbols[j], table->coefficient_matrix[row, 0]);
+                }
+            }
+        } else {
+            for (const auto& [variable, value] : solution) {
+                if (is_structural(variable)) {
+                    consider(GLOBAL_SYMBOLS.intern(variable), value);
+                }
+            }
+        }
+        std::ranges::stable_sort(candidates, std::ranges::greater(), &std::pair<double, std::pair<Symbol, algebra::Fraction>>::first);
+
+        if (branching == Branching::MOST_FRACTIONAL) {
+            return candidates.front().second;
+        }
+        const int size = candidates.size();
+
+        if (branching == Branching::RELIABILITY && table) {
+            for (int k = 0, looked = 0; k < size && looked < STRONG_CANDIDATES; k++) {
+                const auto& [symbol, value] = candidates[k].second;
+
+                if (!pseudocosts.is_reliable(symbol, reliability)) {
+                    look_ahead(pseudocosts, *table, symbol, value, solution.at(Z));
+                    looked++;
+                }
+            }
+        }
+        auto score = [&pseudocosts](const std::pair<double, std::pair<Symbol, algebra::Fraction>>& candidate) -> double {
+            const auto& [symbol, value] = candidate.second;
+            return pseudocosts.score(symbol, static_cast<double>(value - floor(value)));
+        };
+        return std::ranges::max_element(candidates, {}, score)->second;
+    }
+
+    // down, up
+    static std::array<Node, 2> children(const int id, const Symbol symbol, const algebra::Fraction& value, const algebra::Fraction& bound) {
+        const int64_t down = floor(value);
+        const double fraction = static_cast<double>(value - down);
+        return {Node{id, symbol, true, down, bound, fraction}, Node{id, symbol, false, down + 1, bound, 1 - fraction}};
+    }
+
+    bool is_heuristic_node(const int id, const int solved) const {
+        return heuristics && (id == 0 || heuristic_frequency && solved % heuristic_frequency == 0);
+    }
+
+    std::optional<Incumbent> heuristic(const CompiledModel<algebra::Fraction>& compiled, const ComputationalTable& table,
+                                       const std::map<algebra::Variable, algebra::Fraction>& relaxation, const bool is_root) const {
+        std::optional<Incumbent> res;
+        auto consider = [this, &res](std::optional<std::map<algebra::Variable, algebra::Fraction>>&& candidate, const char* source) -> void {
+            if (candidate && (!res || is_better(candidate->at(Z), res->value))) {
+                res = Incumbent{candidate->at(Z), std::move(*candidate), source};
+            }
+        };
+        consider(round_best(compiled, relaxation, type == Optimization::MAXIMIZE), "rounding");
+        consider(dive(table, relaxation), "diving");
+
+        if (is_root) {
+            consider(feasibility_pump(compiled, relaxation), "pump");
+        }
+        return res;
+    }
+
+    static double elapsed(const Clock::time_point start) { return std::chrono::duration<double, std::milli>(Clock::now() - start).count(); }
+
+    void optimize_parallel(const CompiledModel<algebra::Fraction>& compiled, Clock::time_point start, std::vector<Incumbent>& history) const;
+
+    void optimize_deterministic(const CompiledModel<algebra::Fraction>& compiled, Clock::time_point start, std::vector<Incumbent>& history) const;
+
 public:
+    NodeSelection node_selection = NodeSelection::BREADTH_FIRST;
+    int threads = 1;
+    bool deterministic = false; // parallel rounds that give the same result for any thread timing
+    int cut_rounds = 0; // Gomory cut rounds at the root
+    bool node_cuts = false; // branch and cut, also runs cut_rounds at every node
+    Branching branching = Branching::MOST_FRACTIONAL;
+    int reliability = 4; // observations per direction before a pseudocost is trusted
+    bool heuristics = true; // rounding, diving and the feasibility pump at the root
+    int heuristic_frequency = 16; // nodes between heuristic runs, 0 for the root only
+
     using LPP::LPP;
 
-    std::variant<std::map<algebra::Variable, algebra::Fraction>, Solution> optimize_branch_bound(const std::string& path) const {
-        int i = 1;
-        algebra::Fraction optimal = type == Optimization::MAXIMIZE ? -algebra::inf : algebra::inf;
-        std::queue<IPP> queue;
-        std::map<algebra::Variable, algebra::Fraction> res;
-        queue.push(*this);
-        std::filesystem::create_directories(path);
+    // plots each node when given a path
+    std::variant<std::map<algebra::Variable, algebra::Fraction>, Solution> optimize_branch_bound(const std::string& = "") const;
+};
+
+inline void optimization::IPP::optimize_parallel(const CompiledModel<algebra::Fraction>& compiled, const Clock::time_point start,
+                                                 std::vector<Incumbent>& history) const {
+    struct Worker {
+        std::mutex mutex;
+        std::deque<int> nodes; // the owner dives from the back, thieves steal from the front
+    };
+    std::vector<Worker> workers(threads);
+    std::mutex pool_mutex, history_mutex; // nodes and tables, incumbents
+    std::vector<Node> nodes;
+    Tables tables;
+    std::atomic<int> pending = 0, queued = 0, solved = 0; // unprocessed, in a deque, solved
+    std::mutex idle_mutex;
+    std::condition_variable idle; // workers without nodes wait here
+    std::exception_ptr failure; // the first exception of a worker, guarded by idle_mutex
+    std::atomic<bool> failed = false; // set with failure, checked before each node
+    std::atomic<std::shared_ptr<const Incumbent>> incumbent; // read without locking for pruning
+    Pseudocosts pseudocosts;
+    auto push = [&](const int worker, const Node& node) -> void {
+        int id;
+        {
+            std::lock_guard lock(pool_mutex);
+            id = nodes.size();
+            nodes.push_back(node);
+        }
+        pending++;
+        {
+            std::lock_guard lock(workers[worker].mutex);
+            workers[worker].nodes.push_back(id);
+        }
+        queued++;
+        std::lock_guard lock(idle_mutex); // a waiter has either seen queued or is waiting
+        idle.notify_one();
+    };
+    auto take = [&](const int worker) -> int {
+        for (int k = 0; k < threads; k++) {
+            Worker& victim = workers[(worker + k) % threads];
+            std::lock_guard lock(victim.mutex);
 
-        while (!queue.empty()) {
-            IPP current = queue.front();
-            std::variant<std::map<algebra::Variable, algebra::Fraction>, Solution> result =
-                current.optimize_graphical(path + "/graph" + std::to_string(i++) + ".png");
-            queue.pop();
+            if (!victim.nodes.empty()) {
+                const int id = k ? victim.nodes.front() : victim.nodes.back();
+                k ? victim.nodes.pop_front() : victim.nodes.pop_back();
+                queued--;
+                return id;
+            }
+        }
+        return -1;
+    };
+    auto offer = [&](Incumbent&& candidate) -> void {
+        std::lock_guard lock(history_mutex);
+
+        if (const std::shared_ptr<const Incumbent> best = incumbent.load(); !best || is_better(candidate.value, best->value)) {
+            candidate.time = elapsed(start);
+            history.push_back(candidate);
+            incumbent.store(std::make_shared<const Incumbent>(std::move(candidate)));
+        }
+    };
+    auto process = [&](const int worker, const int id) -> void {
+        Node current;
+        std::shared_ptr<const ComputationalTable> parent_table;
+        IPP model;
+        {
+            std::lock_guard lock(pool_mutex);
+            current = nodes[id];
+            parent_table = current.parent != -1 ? take_table(tables, current.parent) : nullptr;
 
+            if (!parent_table) {
+                model = rebuild(nodes, id);
+            }
+        }
+        if (const std::shared_ptr<const Incumbent> best = incumbent.load(); best && !is_better(current.bound, best->value)) {
+            return; // pruned by bound
+        }
+        std::shared_ptr<ComputationalTable> table;
+        const std::variant<std::map<algebra::Variable, algebra::Fraction>, Solution> result = solve(current, parent_table, model, table);
+        const std::map<algebra::Variable, algebra::Fraction>* ans = std::get_if<std::map<algebra::Variable, algebra::Fraction>>(&result);
+
+        if (!ans) {
+            return;
+        }
+        const algebra::Fraction& value = ans->at(Z);
+        const bool is_fractional = !is_integral(*ans);
+        observe(pseudocosts, current, value);
+
+        if (is_fractional && is_heuristic_node(id, ++solved)) {
+            if (std::optional<Incumbent> candidate = heuristic(compiled, *table, *ans, id == 0)) {
+                offer(std::move(*candidate));
+            }
+        }
+        if (const std::shared_ptr<const Incumbent> best = incumbent.load(); best && !is_better(value, best->value)) {
+            return;
+        }
+        if (!is_fractional) {
+            offer({value, *ans, "node"});
+            return;
+        }
+        const auto [symbol, fraction] = select_branch(*ans, table.get(), pseudocosts);
+        {
+            std::lock_guard lock(pool_mutex);
+            cache_table(tables, id, std::move(table));
+        }
+        for (const Node& child : children(id, symbol, fraction, value)) {
+            push(worker, child);
+        }
+    };
+    push(0, {-1, SymbolTable::NONE, false, 0, type == Optimization::MAXIMIZE ? algebra::inf : -algebra::inf, 0});
+    {
+        std::vector<std::jthread> pool;
+        pool.reserve(threads);
+
+        for (int worker = 0; worker < threads; worker++) {
+            pool.emplace_back([&, worker] -> void {
+                LOG_SUPPRESSED = true;
+
+                try {
+                    while (true) {
+                        if (failed) {
+                            return;
+                        }
+                        if (const int id = take(worker); id != -1) {
+                            process(worker, id);
+
+                            if (--pending == 0) { // children are pushed first
+                                std::lock_guard lock(idle_mutex);
+                                idle.notify_all();
+                            }
+                            continue;
+                        }
+                        std::unique_lock lock(idle_mutex);
+                        idle.wait(lock, [&] -> bool { return queued > 0 || pending == 0 || failure; });
+
+                        if (pending == 0 || failure) {
+                            return;
+                        }
+                    }
+                } catch (...) {
+                    std::lock_guard lock(idle_mutex);
+
+                    if (!failure) {
+                        failure = std::current_exception();
+                    }
+                    failed = true;
+                    idle.notify_all();
+                }
+            });
+        }
+    }
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+
+inline void optimization::IPP::optimize_deterministic(const CompiledModel<algebra::Fraction>& compiled, const Clock::time_point start,
+                                                      std::vector<Incumbent>& history) const {
+    std::vector<Node> nodes{{-1, SymbolTable::NONE, false, 0, type == Optimization::MAXIMIZE ? algebra::inf : -algebra::inf, 0}};
+    std::vector<int> frontier{0}; // depth first, a round takes up to threads nodes from the back
+    Tables tables;
+    Pseudocosts pseudocosts;
+    int solved = 0;
+    auto is_pruned = [&](const algebra::Fraction& bound) -> bool { return !history.empty() && !is_better(bound, history.back().value); };
+    auto offer = [&](Incumbent&& candidate) -> void {
+        if (!is_pruned(candidate.value)) {
+            candidate.time = elapsed(start);
+            history.push_back(std::move(candidate));
+        }
+    };
+    std::vector<int> batch;
+    std::vector<std::shared_ptr<const ComputationalTable>> parent_tables;
+    std::vector<IPP> models;
+    std::vector<std::variant<std::map<algebra::Variable, algebra::Fraction>, Solution>> results;
+    std::vector<std::shared_ptr<ComputationalTable>> tableaus;
+    std::vector<std::exception_ptr> failures;
+    std::atomic<int> next = 0; // the next batch entry to solve
+    bool done = false;
+    std::barrier round(threads + 1); // the calling thread opens and closes every round
+    std::vector<std::jthread> pool;
+    pool.reserve(threads);
+
+    for (int worker = 0; worker < threads; worker++) {
+        pool.emplace_back([&] -> void {
+            LOG_SUPPRESSED = true;
+
+            while (true) {
+                round.arrive_and_wait(); // batch ready
+
+                if (done) {
+                    return;
+                }
+                for (int k = next++; k < static_cast<int>(batch.size()); k = next++) {
+                    try {
+                        results[k] = solve(nodes[batch[k]], parent_tables[k], models[k], tableaus[k]);
+                    } catch (...) {
+                        failures[k] = std::current_exception();
+                    }
+                }
+                round.arrive_and_wait(); // batch solved
+            }
+        });
+    }
+    struct Release { // lets the workers leave before the pool joins, also when an exception unwinds
+        bool& done;
+        std::barrier<>& round;
+
+        ~Release() {
+            done = true;
+            round.arrive_and_wait();
+        }
+    } release{done, round};
+
+    while (!frontier.empty()) {
+        batch.clear();
+        parent_tables.clear();
+        models.clear();
+
+        while (!frontier.empty() && static_cast<int>(batch.size()) < threads) {
+            const int id = frontier.back();
+            frontier.pop_back();
+            const std::shared_ptr<const ComputationalTable> parent_table = nodes[id].parent != -1 ? take_table(tables, nodes[id].parent) : nullptr;
+
+            if (!is_pruned(nodes[id].bound)) {
+                batch.push_back(id);
+                parent_tables.push_back(parent_table);
+                models.push_back(parent_table ? IPP() : rebuild(nodes, id));
+            }
+        }
+        const int size = batch.size();
+        results.assign(size, Solution::UNOPTIMIZED);
+        tableaus.assign(size, nullptr);
+        failures.assign(size, nullptr);
+        next = 0;
+        round.arrive_and_wait();
+        round.arrive_and_wait();
+
+        for (const std::exception_ptr& failure : failures) { // first in batch order
+            if (failure) {
+                std::rethrow_exception(failure);
+            }
+        }
+        for (int k = 0; k < size; k++) { // batch order keeps ties reproducible
+            const std::map<algebra::Variable, algebra::Fraction>* ans = std::get_if<std::map<algebra::Variable, algebra::Fraction>>(&results[k]);
+
+            if (!ans) {
+                continue;
+            }
+            const algebra::Fraction& value = ans->at(Z);
+            const bool is_fractional = !is_integral(*ans);
+            observe(pseudocosts, nodes[batch[k]], value);
+
+            if (is_fractional && is_heuristic_node(batch[k], ++solved)) {
+                if (std::optional<Incumbent> candidate = heuristic(compiled, *tableaus[k], *ans, batch[k] == 0)) {
+                    offer(std::move(*candidate));
+                }
+            }
+            if (is_pruned(value)) {
+                continue;
+            }
+            if (is_fractional) {
+                const auto [symbol, fraction] = select_branch(*ans, tableaus[k].get(), pseudocosts);
+
+                for (const Node& child : children(batch[k], symbol, fraction, value)) {
+                    frontier.push_back(nodes.size());
+                    nodes.push_back(child);
+                }
+                cache_table(tables, batch[k], std::move(tableaus[k]));
+            } else {
+                offer({value, *ans, "node"});
+            }
+        }
+    }
+}
+
+inline std::variant<std::map<algebra::Variable, algebra::Fraction>, optimization::Solution>
+optimization::IPP::optimize_branch_bound(const std::string& path) const {
+    const Clock::time_point start = Clock::now();
+    std::vector<Incumbent> history; // every improvement, the last is optimal
+    std::vector<algebra::Inequation> model = constraints;
+    model.insert(model.end(), restrictions.begin(), restrictions.end());
+    const CompiledModel<algebra::Fraction> compiled(objective, model); // incumbent checks
+
+    if (threads > 1 && path.empty()) {
+        deterministic ? optimize_deterministic(compiled, start, history) : optimize_parallel(compiled, start, history);
+    } else {
+        int i = 1, solved = 0;
+        std::vector<Node> nodes; // pool, a node's id is its index
+        std::deque<int> frontier;
+        Tables tables;
+        Pseudocosts pseudocosts;
+        auto is_pruned = [&](const algebra::Fraction& bound) -> bool { return !history.empty() && !is_better(bound, history.back().value); };
+        auto is_worse = [this, &nodes](const int lhs, const int rhs) -> bool { return is_better(nodes[rhs].bound, nodes[lhs].bound); }; // heap order
+        auto is_best_first = [this, &history] -> bool {
+            return node_selection == NodeSelection::BEST_FIRST || node_selection == NodeSelection::HYBRID && !history.empty();
+        };
+        auto push = [&](const Node& node) -> void {
+            frontier.push_back(nodes.size());
+            nodes.push_back(node);
+
+            if (is_best_first()) {
+                std::ranges::push_heap(frontier, is_worse);
+            }
+        };
+        auto pop = [&] -> int {
+            int id;
+
+            if (is_best_first()) {
+                std::ranges::pop_heap(frontier, is_worse);
+                id = frontier.back();
+                frontier.pop_back();
+            } else if (node_selection == NodeSelection::BREADTH_FIRST) {
+                id = frontier.front();
+                frontier.pop_front();
+            } else { // depth first, and hybrid diving until the first incumbent
+                id = frontier.back();
+                frontier.pop_back();
+            }
+            return id;
+        };
+        auto offer = [&](Incumbent&& candidate) -> void {
+            if (is_pruned(candidate.value)) {
+                return;
+            }
+            const bool was_best_first = is_best_first();
+            candidate.time = elapsed(start);
+            history.push_back(std::move(candidate));
+
+            if (!was_best_first && is_best_first()) { // hybrid switches from diving to best bound
+                std::ranges::make_heap(frontier, is_worse);
+            }
+        };
+        push({-1, SymbolTable::NONE, false, 0, type == Optimization::MAXIMIZE ? algebra::inf : -algebra::inf, 0});
+
+        if (!path.empty()) {
+            std::filesystem::create_directories(path);
+        }
+        while (!frontier.empty()) {
+            const int id = pop();
+            const Node current = nodes[id];
+            const std::shared_ptr<const ComputationalTable> parent_table = current.parent != -1 ? take_table(tables, current.parent) : nullptr;
+
+            if (is_pruned(current.bound)) {
+                continue; // pruned by bound
+            }
+            std::variant<std::map<algebra::Variable, algebra::Fraction>, Solution> result;
+            std::shared_ptr<ComputationalTable> table;
+
+            if (!path.empty()) {
+                result = rebuild(nodes, id).optimize_graphical(path + "/graph" + std::to_string(i++) + ".svg");
+            } else {
+                result = solve(current, parent_table, parent_table ? IPP() : rebuild(nodes, id), table);
+            }
             if (const std::map<algebra::Variable, algebra::Fraction>* ans = std::get_if<std::map<algebra::Variable, algebra::Fraction>>(&result)) {
-                bool is_fractional = false;
-                auto range = *ans | std::views::filter([](const std::pair<algebra::Variable, algebra::Fraction>& element) -> bool {
-                    return element.second.denominator != 1 && element.first.variables != Z.variables;
-                });
-                auto itr =
-                    std::ranges::max_element(range, {}, [](const std::pair<algebra::Variable, algebra::Fraction>& element) -> algebra::Fraction {
-                        return element.second.numerator % element.second.denominator;
-                    });
-                if (itr != range.end()) {
-                    const auto [variable, fraction] = *itr;
-                    current.constraints.push_back(variable <= static_cast<int64_t>(fraction));
-                    queue.push(current);
-                    current.constraints.back() = variable >= static_cast<int64_t>(fraction) + 1;
-                    queue.push(current);
-                    is_fractional = true;
-                }
-                if (!is_fractional) {
-                    const algebra::Fraction& value = ans->at(Z);
-
-                    if (type == Optimization::MAXIMIZE && optimal < value || type == Optimization::MINIMIZE && optimal > value) {
-                        optimal = value;
-                        res = *ans;
+                const algebra::Fraction& value = ans->at(Z);
+                const bool is_fractional = !is_integral(*ans);
+                observe(pseudocosts, current, value);
+
+                if (is_fractional && table && is_heuristic_node(id, ++solved)) {
+                    if (std::optional<Incumbent> candidate = heuristic(compiled, *table, *ans, id == 0)) {
+                        offer(std::move(*candidate));
+                    }
+                }
+                if (is_pruned(value)) {
+                    continue;
+                }
+                if (is_fractional) {
+                    const auto [symbol, fraction] = select_branch(*ans, table.get(), pseudocosts);
+
+                    for (const Node& child : children(id, symbol, fraction, value)) {
+                        push(child);
                     }
+                    cache_table(tables, id, std::move(table));
+                } else {
+                    offer({value, *ans, "node"});
                 }
             }
         }
-        for (const auto& [variable, fraction] : res) {
+    }
+    if (history.empty()) {
+        return {};
+    }
+    if (is_logging(LogLevel::SUMMARY)) {
+        for (const Incumbent& incumbent : history) {
+            GLOBAL_FORMATTING << "Incumbent Z=" << incumbent.value << " found by " << incumbent.source << " at " << incumbent.time << " ms"
+                              << std::endl;
+        }
+        for (const auto& [variable, fraction] : history.back().solution) {
             GLOBAL_FORMATTING << variable << '=' << fraction << " ";
         }
         GLOBAL_FORMATTING << std::endl;
-        return res;
     }
-};
+    return history.back().solution;
+}
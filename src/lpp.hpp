@@ -5,6 +5,60 @@ protected:
     Optimization type;
     algebra::Polynomial objective;
     std::vector<algebra::Inequation> constraints, restrictions;
+    bool is_negated = false; // standardized from a minimization
+    std::vector<bool> inverted; // constraints multiplied by -1 on the way here, empty when none
+
+    struct HalfPlane { // a x + b y <= c, feasible to the left of the boundary direction (-b, a)
+        algebra::Fraction a, b, c;
+        bool is_box = false; // bounding box edge standing in for infinity
+    };
+
+    static algebra::Point meet(const HalfPlane& lhs, const HalfPlane& rhs) {
+        const algebra::Fraction det = lhs.a * rhs.b - rhs.a * lhs.b;
+        return {(lhs.c * rhs.b - rhs.c * lhs.b) / det, (lhs.a * rhs.c - rhs.a * lhs.c) / det};
+    }
+
+    static bool is_outside(const HalfPlane& plane, const algebra::Point& point) { return plane.a * point.x + plane.b * point.y > plane.c; }
+
+    // angle sort and deque sweep, the boundary counterclockwise, empty when infeasible
+    static std::vector<HalfPlane> intersect(std::vector<HalfPlane> planes) {
+        auto is_upper = [](const HalfPlane& plane) -> bool { return plane.a > 0 || plane.a == 0 && plane.b < 0; };
+        // of the directions
+        auto cross = [](const HalfPlane& lhs, const HalfPlane& rhs) -> algebra::Fraction { return lhs.a * rhs.b - rhs.a * lhs.b; };
+        auto point = [](const HalfPlane& plane) -> algebra::Point {
+            return plane.a != 0 ? algebra::Point(plane.c / plane.a, 0) : algebra::Point(0, plane.c / plane.b);
+        };
+        std::deque<HalfPlane> res;
+        std::ranges::sort(planes, [&](const HalfPlane& lhs, const HalfPlane& rhs) -> bool {
+            return is_upper(lhs) != is_upper(rhs) ? is_upper(lhs) : cross(lhs, rhs) > 0;
+        });
+
+        for (const HalfPlane& plane : planes) {
+            while (res.size() > 1 && is_outside(plane, meet(res[res.size() - 1], res[res.size() - 2]))) {
+                res.pop_back();
+            }
+            while (res.size() > 1 && is_outside(plane, meet(res[0], res[1]))) {
+                res.pop_front();
+            }
+            if (!res.empty() && cross(res.back(), plane) == 0) {
+                if (res.back().a * plane.a + res.back().b * plane.b < 0) {
+                    return {}; // opposite and adjacent after popping, nothing lies between them
+                }
+                if (!is_outside(plane, point(res.back()))) {
+                    continue; // the same direction, keep the tighter one
+                }
+                res.pop_back();
+            }
+            res.push_back(plane);
+        }
+        while (res.size() > 2 && is_outside(res.front(), meet(res[res.size() - 1], res[res.size() - 2]))) {
+            res.pop_back();
+        }
+        while (res.size() > 2 && is_outside(res.back(), meet(res[0], res[1]))) {
+            res.pop_front();
+        }
+        return res.size() < 3 ? std::vector<HalfPlane>() : std::vector<HalfPlane>(res.begin(), res.end());
+    }
 
     friend class ComputationalTable;
     friend std::vector<std::map<algebra::Variable, algebra::Fraction>> optimization::basic_feasible_solutions(const std::vector<algebra::Equation>&);
@@ -23,15 +77,25 @@ public:
     LPP standardize(const bool dual = false) const {
         LPP lpp = *this;
         int i = 1;
-        GLOBAL_FORMATTING << lpp;
+
+        if (is_logging(LogLevel::ITERATION)) {
+            GLOBAL_FORMATTING << lpp;
+        }
 
         if (lpp.type == Optimization::MINIMIZE) {
             lpp.objective *= -1;
             lpp.type = Optimization::MAXIMIZE;
+            lpp.is_negated = true;
         }
-        for (algebra::Inequation& constraint : lpp.constraints) {
+        const int size = lpp.constraints.size();
+        lpp.inverted.resize(size);
+
+        for (int k = 0; k < size; k++) {
+            algebra::Inequation& constraint = lpp.constraints[k];
+
             if (dual && constraint.opr == algebra::RelationalOperator::GE || !dual && static_cast<algebra::Fraction>(constraint.rhs) < 0) {
                 constraint = constraint.invert();
+                lpp.inverted[k] = !lpp.inverted[k];
             }
             if (constraint.opr != algebra::RelationalOperator::EQ) {
                 algebra::Variable variable("s" + std::to_string(i++));
@@ -39,109 +103,184 @@ public:
                     algebra::Equation(constraint.lhs + (constraint.opr == algebra::RelationalOperator::LE ? variable : -variable), constraint.rhs);
             }
         }
-        GLOBAL_FORMATTING << "Standard Form:" << std::endl << lpp;
+        if (is_logging(LogLevel::ITERATION)) {
+            GLOBAL_FORMATTING << "Standard Form:" << std::endl << lpp;
+        }
         return lpp;
     }
 
     LPP canonicalize() const {
         LPP lpp = *this;
-        GLOBAL_FORMATTING << *this;
 
-        for (const algebra::Inequation& constraint : constraints) {
-            if (constraint.opr == algebra::RelationalOperator::EQ) {
+        if (is_logging(LogLevel::ITERATION)) {
+            GLOBAL_FORMATTING << *this;
+        }
+
+        const int size = constraints.size();
+        lpp.inverted.resize(size);
+
+        for (int k = 0; k < size; k++) {
+            if (const algebra::Inequation& constraint = constraints[k]; constraint.opr == algebra::RelationalOperator::EQ) {
                 lpp.constraints.push_back(algebra::Inequation(constraint.lhs, algebra::RelationalOperator::LE, constraint.rhs));
                 lpp.constraints.push_back(algebra::Inequation(constraint.lhs, algebra::RelationalOperator::GE, constraint.rhs));
+                lpp.inverted.push_back(lpp.inverted[k]);
+                lpp.inverted.push_back(lpp.inverted[k]);
+            }
+        }
+        for (int k = size - 1; k >= 0; k--) {
+            if (constraints[k].opr == algebra::RelationalOperator::EQ) {
+                lpp.inverted.erase(lpp.inverted.begin() + k);
             }
         }
         std::erase_if(lpp.constraints,
                       [](const algebra::Inequation& inequation) -> bool { return inequation.opr == algebra::RelationalOperator::EQ; });
+        const int count = lpp.constraints.size();
 
-        for (algebra::Inequation& constraint : lpp.constraints) {
-            if (type == Optimization::MAXIMIZE && constraint.opr == algebra::RelationalOperator::GE ||
+        for (int k = 0; k < count; k++) {
+            if (algebra::Inequation& constraint = lpp.constraints[k];
+                type == Optimization::MAXIMIZE && constraint.opr == algebra::RelationalOperator::GE ||
                 type == Optimization::MINIMIZE && constraint.opr == algebra::RelationalOperator::LE) {
                 constraint = constraint.invert();
+                lpp.inverted[k] = !lpp.inverted[k];
             }
         }
-        GLOBAL_FORMATTING << "Canonical Form:" << std::endl << lpp;
+        if (is_logging(LogLevel::ITERATION)) {
+            GLOBAL_FORMATTING << "Canonical Form:" << std::endl << lpp;
+        }
         return lpp;
     }
 
     std::variant<std::map<algebra::Variable, algebra::Fraction>, Solution> optimize_graphical(const std::string& path) const {
         assert(objective.expression.size() <= 2);
-        const int size = constraints.size();
-        algebra::Point res;
-        algebra::Fraction limit, optimal = type == Optimization::MAXIMIZE ? -algebra::inf : algebra::inf, second_optimal = optimal;
-        algebra::Graph graph;
-        std::vector<algebra::Polynomial> polynomials;
-        std::vector<algebra::Point> points{{0, 0}};
-        const std::vector<std::vector<int>> combinations = algebra::detail::generate_combinations(size, 2);
-        graph.source_path = "/home/dream/github/optimization-technique/linear-algebra/algebra/utils/graph.py";
-        polynomials.reserve(size);
-        GLOBAL_FORMATTING << *this;
+        const algebra::Variable x("x"), y("y");
+        auto coefficient = [](const algebra::Polynomial& polynomial, const algebra::Variable& variable) -> algebra::Fraction {
+            const auto itr = std::ranges::find_if(polynomial.expression, [&variable](const algebra::Variable& term) -> bool {
+                return term.variables == variable.variables;
+            });
+            return itr != polynomial.expression.end() ? itr->coefficient : 0;
+        };
+        auto absolute = [](const algebra::Fraction& value) -> algebra::Fraction { return value < 0 ? -value : value; };
+        std::vector<HalfPlane> planes{{-1, 0, 0}, {0, -1, 0}}; // x >= 0, y >= 0
+        algebra::Fraction limit, max_rhs, max_coefficient;
+        Renderer::Figure figure{path};
 
-        for (const algebra::Inequation& constraint : constraints) {
-            if (static_cast<algebra::Fraction>(constraint.rhs) != 0) {
-                polynomials.push_back(constraint.lhs / static_cast<algebra::Fraction>(constraint.rhs));
-            }
-            for (const algebra::Variable& variable : polynomials.back().expression) {
-                if (variable.variables == algebra::Variable("x").variables) {
-                    points.emplace_back(variable.coefficient.reciprocate(), 0);
-                } else if (variable.variables == algebra::Variable("y").variables) {
-                    points.emplace_back(0, variable.coefficient.reciprocate());
-                }
+        if (is_logging(LogLevel::ITERATION)) {
+            GLOBAL_FORMATTING << *this;
+        }
+
+        for (const algebra::Inequation& inequation : std::array{constraints, restrictions} | std::views::join) {
+            if (inequation.lhs.is_fraction() && static_cast<algebra::Fraction>(inequation.lhs) == algebra::inf ||
+                inequation.rhs.is_fraction() && static_cast<algebra::Fraction>(inequation.rhs) == algebra::inf) {
+                continue; // unrestricted
+            }
+            const algebra::Fraction a = coefficient(inequation.lhs, x), b = coefficient(inequation.lhs, y);
+            const algebra::Fraction c = static_cast<algebra::Fraction>(inequation.rhs);
+            const algebra::Fraction scale = algebra::Fraction(a.denominator) * algebra::Fraction(b.denominator) * algebra::Fraction(c.denominator);
+
+            if (inequation.opr != algebra::RelationalOperator::GE) {
+                planes.push_back({a, b, c});
+            }
+            if (inequation.opr != algebra::RelationalOperator::LE) {
+                planes.push_back({-a, -b, -c});
+            }
+            max_rhs = std::max(max_rhs, absolute(c * scale));
+            max_coefficient = std::max({max_coefficient, absolute(a * scale), absolute(b * scale)});
+
+            for (const algebra::Fraction& intercept : {a != 0 ? c / a : algebra::Fraction(), b != 0 ? c / b : algebra::Fraction()}) {
+                limit = std::max(limit, intercept);
             }
         }
-        for (const std::vector<int>& combination : combinations) {
-            std::map<algebra::Variable, algebra::Fraction> solution =
-                linalg::solve_linear_system({algebra::Equation(constraints[combination[0]]), algebra::Equation(constraints[combination[1]])});
-            points.emplace_back(solution[algebra::Variable("x")], solution[algebra::Variable("y")]);
+        for (const algebra::Inequation& constraint : constraints) {
+            figure.constraints.push_back({static_cast<double>(coefficient(constraint.lhs, x)), static_cast<double>(coefficient(constraint.lhs, y)),
+                                          static_cast<double>(static_cast<algebra::Fraction>(constraint.rhs)),
+                                          constraint.opr == algebra::RelationalOperator::LE   ? -1
+                                          : constraint.opr == algebra::RelationalOperator::GE ? 1
+                                                                                              : 0});
         }
-        std::ranges::sort(points);
-        points.erase(std::ranges::unique(points).begin(), points.end());
+        // with integral rows vertices lie inside the box, so it only cuts unbounded regions
+        const algebra::Fraction box = algebra::Fraction(2) * max_rhs * max_coefficient + 1;
+        planes.push_back({1, 0, box, true});
+        planes.push_back({0, 1, box, true});
+        const std::vector<HalfPlane> boundary = intersect(std::move(planes));
+        const int size = boundary.size();
+        const algebra::Fraction cx = coefficient(objective, x), cy = coefficient(objective, y);
+        auto is_better = [this](const algebra::Fraction& lhs, const algebra::Fraction& rhs) -> bool {
+            return type == Optimization::MAXIMIZE ? lhs > rhs : lhs < rhs;
+        };
+        std::vector<algebra::Point> vertices, critical_points; // all, and those of two constraints
+        bool is_unbounded = false;
 
-        for (const algebra::Point& point : points) {
-            std::vector<std::pair<std::string, algebra::Fraction>> substituent = {{"x", point.x}, {"y", point.y}};
+        for (int k = 0; k < size; k++) { // edge between boundary[k - 1] and boundary[k + 1]
+            const HalfPlane &plane = boundary[k], &previous = boundary[(k + size - 1) % size], &next = boundary[(k + 1) % size];
+            const algebra::Fraction change = cy * plane.a - cx * plane.b; // objective along (-b, a)
+            vertices.push_back(meet(plane, next));
 
-            if (point.x >= 0 && point.y >= 0) {
-                limit = std::max({limit, point.x, point.y});
+            if (plane.is_box) {
+                continue;
             }
-            if (point.x >= 0 && point.y >= 0 &&
-                std::ranges::all_of(std::array{constraints, restrictions} | std::views::join,
-                                    [&substituent](const algebra::Inequation& constraint) -> bool {
-                                        return static_cast<bool>(constraint.substitute(substituent));
-                                    })) {
-                const auto value = static_cast<algebra::Fraction>(objective.substitute(substituent));
+            if (!next.is_box) {
+                critical_points.push_back(vertices.back());
+                limit = std::max({limit, vertices.back().x, vertices.back().y});
+            }
+            // edges running into the box are the extreme rays of the recession cone
+            is_unbounded = is_unbounded || next.is_box && is_better(change, 0) || previous.is_box && is_better(-change, 0);
+        }
+        std::ranges::sort(vertices);
+        vertices.erase(std::ranges::unique(vertices).begin(), vertices.end());
 
-                if (type == Optimization::MAXIMIZE && optimal < value || type == Optimization::MINIMIZE && optimal > value) {
-                    second_optimal = optimal;
-                    optimal = value;
-                    res = point;
-                } else if (type == Optimization::MAXIMIZE && second_optimal < value || type == Optimization::MINIMIZE && second_optimal > value) {
-                    second_optimal = value;
-                }
+        if (is_logging(LogLevel::ITERATION)) {
+            GLOBAL_FORMATTING << "Critical points: ";
+
+            for (const algebra::Point& point : critical_points) {
+                GLOBAL_FORMATTING << point << ' ';
             }
+            GLOBAL_FORMATTING << std::endl;
         }
-        GLOBAL_FORMATTING << "Critical points: ";
+        algebra::Point res;
+        algebra::Fraction optimal = type == Optimization::MAXIMIZE ? -algebra::inf : algebra::inf;
+        int ties = 0; // optimal vertices, an optimal edge has two
 
-        for (const algebra::Point& point : points) {
-            GLOBAL_FORMATTING << point << ' ';
+        for (const algebra::Point& vertex : vertices) {
+            if (const algebra::Fraction value = cx * vertex.x + cy * vertex.y; is_better(value, optimal)) {
+                optimal = value;
+                res = vertex;
+                ties = 1;
+            } else if (value == optimal) {
+                ties++;
+            }
         }
-        GLOBAL_FORMATTING << std::endl;
+        for (const algebra::Point& point : critical_points) {
+            figure.points.emplace_back(static_cast<double>(point.x), static_cast<double>(point.y));
+        }
+        figure.limit = std::max(static_cast<double>(limit), 1.0) * 1.25;
 
-        if (graph.plot(constraints, points, limit, path) && type == Optimization::MAXIMIZE) {
-            GLOBAL_FORMATTING << "Unbounded Solution" << std::endl;
+        if (size) {
+            figure.optimum = {static_cast<double>(res.x), static_cast<double>(res.y)};
+        }
+        GLOBAL_RENDERER.render(std::move(figure));
+
+        if (is_unbounded) {
+            if (is_logging(LogLevel::SUMMARY)) {
+                GLOBAL_FORMATTING << "Unbounded Solution" << std::endl;
+            }
             return Solution::UNBOUNDED;
         }
-        if (type == Optimization::MAXIMIZE && optimal == -algebra::inf || type == Optimization::MINIMIZE && optimal == algebra::inf) {
-            GLOBAL_FORMATTING << "Infeasible Solution" << std::endl;
+        if (!size) {
+            if (is_logging(LogLevel::SUMMARY)) {
+                GLOBAL_FORMATTING << "Infeasible Solution" << std::endl;
+            }
             return Solution::INFEASIBLE;
         }
-        if (second_optimal == optimal) {
-            GLOBAL_FORMATTING << "Infinitely Many Solutions" << std::endl;
+        if (ties > 1) {
+            if (is_logging(LogLevel::SUMMARY)) {
+                GLOBAL_FORMATTING << "Infinitely Many Solutions" << std::endl;
+            }
             return Solution::ALTERNATE;
         }
-        GLOBAL_FORMATTING << Z << '=' << optimal << " x=" << res.x << " y=" << res.y << std::endl;
-        return std::map{std::pair{Z, optimal}, {algebra::Variable("x"), res.x}, {algebra::Variable("y"), res.y}};
+        if (is_logging(LogLevel::SUMMARY)) {
+            GLOBAL_FORMATTING << Z << '=' << optimal << " x=" << res.x << " y=" << res.y << std::endl;
+        }
+        return std::map{std::pair{Z, optimal}, {x, res.x}, {y, res.y}};
     }
 
     ComputationalTable tabular_optimize(const std::string& = "simplex") const;
@@ -173,44 +312,141 @@ public:
     }
 };
 
-inline std::vector<std::map<algebra::Variable, algebra::Fraction>>
-optimization::basic_feasible_solutions(const std::vector<algebra::Equation>& equations) {
-    std::map<algebra::Variable, std::vector<algebra::Fraction>> variables;
+template <typename Visitor>
+void optimization::for_each_basic_feasible_solution(const std::vector<algebra::Equation>& equations, Visitor&& visit) {
+    const int size = equations.size();
+    std::map<algebra::Variable, std::vector<std::pair<int, algebra::Fraction>>> entries;
+    std::vector<algebra::Fraction> rhs;
+    rhs.reserve(size);
 
-    for (const algebra::Equation& equation : equations) {
-        GLOBAL_FORMATTING << equation << std::endl;
-    }
-    for (const algebra::Equation& equation : equations) {
-        for (const algebra::Variable& variable : equation.lhs.expression) {
-            variables[variable.basis()].push_back(variable.coefficient);
+    for (int i = 0; i < size; i++) {
+        for (const algebra::Variable& variable : equations[i].lhs.expression) {
+            entries[variable.basis()].emplace_back(i, variable.coefficient);
         }
-        variables[LPP::B].push_back(static_cast<algebra::Fraction>(equation.rhs));
+        rhs.push_back(static_cast<algebra::Fraction>(equations[i].rhs));
     }
-    const int col = std::ranges::max(variables | std::views::drop(1) | std::views::values, {}, &std::vector<algebra::Fraction>::size).size();
-    const int row = variables.size() - 1, n = std::max(row, col), k = std::min(row, col);
-    std::vector<std::map<algebra::Variable, algebra::Fraction>> result;
+    const int n = entries.size();
+
+    if (size == 0 || n < size) {
+        return;
+    }
+    SparseMatrix<algebra::Fraction> matrix(size);
+    std::vector<algebra::Variable> variables;
+    variables.reserve(n);
+
+    for (const auto& [variable, column] : entries) {
+        variables.push_back(variable);
+        matrix.push_column(column);
+    }
+    std::vector<int> c(size + 3); // revolving door order, Knuth's Algorithm R
+    std::iota(c.begin() + 1, c.begin() + size + 1, 0);
+    c[size + 1] = n;
+    auto next = [&c, size, n] -> bool {
+        if (size == n) {
+            return false;
+        }
+        if (size == 1) {
+            return ++c[1] < n;
+        }
+        if (size % 2 && c[1] + 1 < c[2]) {
+            c[1]++;
+            return true;
+        }
+        if (size % 2 == 0 && c[1] > 0) {
+            c[1]--;
+            return true;
+        }
+        for (int j = 2, is_decrease = size % 2; j <= size;) {
+            if (is_decrease) {
+                if (c[j] >= j) {
+                    c[j] = c[j - 1];
+                    c[j - 1] = j - 2;
+                    return true;
+                }
+                j++;
+                is_decrease = false;
+            } else {
+                if (c[j] + 1 < c[j + 1]) {
+                    c[j - 1] = c[j];
+                    c[j]++;
+                    return true;
+                }
+                j++;
+                is_decrease = true;
+            }
+        }
+        return false;
+    };
+    std::vector<int> basis(c.begin() + 1, c.begin() + size + 1), previous; // basis position -> column
+    BasisFactorization<algebra::Fraction> factorization;
+    bool is_factorized = false;
+
+    do {
+        const std::span<const int> current(c.data() + 1, size);
 
-    for (const std::vector<int>& combination : algebra::detail::generate_combinations(n, k)) {
-        linalg::Matrix<algebra::Fraction> B(k, k), C(k, 1);
-        std::vector<algebra::Variable> X;
-        X.reserve(k);
+        if (!previous.empty()) { // one column changed, an eta update
+            std::vector<int> leaving, entering;
+            std::ranges::set_difference(previous, current, std::back_inserter(leaving));
+            std::ranges::set_difference(current, previous, std::back_inserter(entering));
+            previous.assign(current.begin(), current.end());
+            const int row = std::ranges::find(basis, leaving.front()) - basis.begin();
+            basis[row] = entering.front();
 
-        for (int i = 0; i < k; i++) {
-            const auto itr = std::next(variables.begin(), combination[i] + 1); // B
+            if (is_factorized && !factorization.is_stale()) {
+                std::vector<algebra::Fraction> alpha(size, 0);
+                const std::span<const int> indices = matrix.indices(entering.front());
+                const std::span<const algebra::Fraction> values = matrix.values(entering.front());
 
-            for (int j = 0; j < k; j++) {
-                B[j, i] = itr->second[j];
+                for (int k = 0; k < static_cast<int>(indices.size()); k++) {
+                    alpha[indices[k]] = values[k];
+                }
+                factorization.ftran(alpha);
+
+                if (alpha[row] != 0) {
+                    factorization.update(row, alpha);
+                } else {
+                    is_factorized = false; // singular
+                    continue;
+                }
+            } else {
+                is_factorized = false;
             }
-            X.push_back(itr->first);
-            C[i, 0] = variables[LPP::B][i];
+        } else {
+            previous.assign(current.begin(), current.end());
+        }
+        if (!is_factorized && !(is_factorized = factorization.factorize(matrix, basis))) {
+            continue; // singular basis
+        }
+        std::vector<algebra::Fraction> x = rhs;
+        factorization.ftran(x);
+
+        if (std::ranges::any_of(x, [](const algebra::Fraction& value) -> bool { return value < 0; })) {
+            continue; // infeasible basis
         }
-        linalg::Matrix<algebra::Fraction> res = B.inverse() * C;
-        std::map<algebra::Variable, algebra::Fraction> element;
+        std::map<algebra::Variable, algebra::Fraction> solution;
 
-        for (int i = 0; i < k; i++) {
-            element[X[i]] = res[i, 0];
+        for (int i = 0; i < size; i++) {
+            solution.emplace(variables[basis[i]], x[i]);
         }
-        result.push_back(element);
+        visit(solution);
+    } while (next());
+}
+
+inline std::vector<std::map<algebra::Variable, algebra::Fraction>>
+optimization::basic_feasible_solutions(const std::vector<algebra::Equation>& equations) {
+    std::vector<std::map<algebra::Variable, algebra::Fraction>> result;
+
+    if (is_logging(LogLevel::ITERATION)) {
+        for (const algebra::Equation& equation : equations) {
+            GLOBAL_FORMATTING << equation << std::endl;
+        }
+    }
+    for_each_basic_feasible_solution(equations, [&result](const std::map<algebra::Variable, algebra::Fraction>& solution) -> void {
+        result.push_back(solution);
+    });
+
+    if (!is_logging(LogLevel::SUMMARY)) {
+        return result;
     }
     GLOBAL_FORMATTING << "Basic Feasible Solutions:" << std::endl;
 
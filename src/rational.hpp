@@ -0,0 +1,120 @@
+#pragma once
+
+class optimization::Rational { // exact pivoting in optimize_revised_simplex, tables and solutions stay algebra::Fraction
+    Integer numerator, denominator = 1; // reduced, denominator > 0
+
+    void reduce() {
+        if (is_small()) {
+            int64_t n = static_cast<int64_t>(numerator), d = static_cast<int64_t>(denominator);
+
+            if (d < 0) {
+                n = -n;
+                d = -d;
+            }
+            const int64_t gcd = std::gcd(n, d);
+            numerator = n / gcd;
+            denominator = d / gcd;
+            return;
+        }
+        if (denominator.sign() < 0) {
+            numerator = -numerator;
+            denominator = -denominator;
+        }
+        const Integer gcd = Integer::gcd(numerator, denominator);
+
+        if (gcd != 1) {
+            numerator /= gcd;
+            denominator /= gcd;
+        }
+    }
+
+public:
+    Rational(const int64_t value = 0) : numerator(value) {}
+
+    Rational(Integer numerator, Integer denominator) : numerator(std::move(numerator)), denominator(std::move(denominator)) { reduce(); }
+
+    explicit Rational(const algebra::Fraction& fraction) : Rational(fraction.numerator, fraction.denominator) {}
+
+    bool is_small() const { return numerator.is_small() && denominator.is_small(); }
+
+    explicit operator algebra::Fraction() const {
+        if (!is_small()) {
+            throw std::overflow_error("Rational does not fit in a Fraction");
+        }
+        return algebra::Fraction(static_cast<int64_t>(numerator), static_cast<int64_t>(denominator));
+    }
+
+    explicit operator double() const { return static_cast<double>(numerator) / static_cast<double>(denominator); }
+
+    Rational operator-() const {
+        Rational res = *this;
+        res.numerator = -numerator;
+        return res;
+    }
+
+    friend Rational operator+(const Rational& lhs, const Rational& rhs) {
+        if (lhs.is_small() && rhs.is_small()) {
+            const int64_t a = static_cast<int64_t>(lhs.numerator), b = static_cast<int64_t>(lhs.denominator);
+            const int64_t c = static_cast<int64_t>(rhs.numerator), d = static_cast<int64_t>(rhs.denominator), gcd = std::gcd(b, d);
+            int64_t ad, cb, numerator, denominator;
+
+            if (!__builtin_mul_overflow(a, d / gcd, &ad) && !__builtin_mul_overflow(c, b / gcd, &cb) &&
+                !__builtin_add_overflow(ad, cb, &numerator) && !__builtin_mul_overflow(b / gcd, d, &denominator)) {
+                return Rational(numerator, denominator);
+            }
+        }
+        return Rational(lhs.numerator * rhs.denominator + rhs.numerator * lhs.denominator, lhs.denominator * rhs.denominator);
+    }
+
+    friend Rational operator-(const Rational& lhs, const Rational& rhs) { return lhs + -rhs; }
+
+    friend Rational operator*(const Rational& lhs, const Rational& rhs) {
+        if (lhs.is_small() && rhs.is_small()) {
+            int64_t numerator, denominator;
+
+            if (!__builtin_mul_overflow(static_cast<int64_t>(lhs.numerator), static_cast<int64_t>(rhs.numerator), &numerator) &&
+                !__builtin_mul_overflow(static_cast<int64_t>(lhs.denominator), static_cast<int64_t>(rhs.denominator), &denominator)) {
+                return Rational(numerator, denominator);
+            }
+        }
+        return Rational(lhs.numerator * rhs.numerator, lhs.denominator * rhs.denominator);
+    }
+
+    friend Rational operator/(const Rational& lhs, const Rational& rhs) {
+        return lhs * Rational(rhs.denominator, rhs.numerator);
+    }
+
+    Rational& operator+=(const Rational& other) { return *this = *this + other; }
+
+    Rational& operator-=(const Rational& other) { return *this = *this - other; }
+
+    Rational& operator*=(const Rational& other) { return *this = *this * other; }
+
+    Rational& operator/=(const Rational& other) { return *this = *this / other; }
+
+    friend bool operator==(const Rational& lhs, const Rational& rhs) = default;
+
+    friend std::strong_ordering operator<=>(const Rational& lhs, const Rational& rhs) {
+        if (lhs.denominator == rhs.denominator) {
+            return lhs.numerator <=> rhs.numerator;
+        }
+        if (lhs.is_small() && rhs.is_small()) {
+            int64_t ad, cb;
+
+            if (!__builtin_mul_overflow(static_cast<int64_t>(lhs.numerator), static_cast<int64_t>(rhs.denominator), &ad) &&
+                !__builtin_mul_overflow(static_cast<int64_t>(rhs.numerator), static_cast<int64_t>(lhs.denominator), &cb)) {
+                return ad <=> cb;
+            }
+        }
+        return lhs.numerator * rhs.denominator <=> rhs.numerator * lhs.denominator;
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, const Rational& rational) {
+        out << rational.numerator;
+
+        if (rational.denominator != 1) {
+            out << '/' << rational.denominator;
+        }
+        return out;
+    }
+};
@@ -0,0 +1,203 @@
+#pragma once
+
+class optimization::Renderer { // graphical solutions as SVG
+public:
+    struct Constraint { // a x + b y (sense) c, sense is -1 for <=, 0 for = and 1 for >=
+        double a, b, c;
+        int sense;
+    };
+
+    struct Figure {
+        std::string path;
+        double limit; // both axes span [0, limit]
+        std::vector<Constraint> constraints;
+        std::vector<std::pair<double, double>> points; // critical points
+        std::optional<std::pair<double, double>> optimum;
+    };
+
+private:
+    static constexpr int SIZE = 600, MARGIN = 40, TICKS = 5;
+    static constexpr double EPSILON = 1e-9;
+    inline static const std::array<const char*, 8> PALETTE{"#1f77b4", "#ff7f0e", "#2ca02c", "#d62728", "#9467bd", "#8c564b", "#e377c2", "#17becf"};
+
+    std::mutex mutex;
+    std::condition_variable_any condition, idle;
+    std::queue<Figure> jobs;
+    int pending = 0; // queued or being written
+    std::exception_ptr failure; // first failed background write, rethrown by wait
+    std::jthread worker; // last, so it joins before the queue is destroyed
+
+    // Sutherland-Hodgman, clips polygon to a x + b y <= c
+    static std::vector<std::pair<double, double>> clip(const std::vector<std::pair<double, double>>& polygon, const double a, const double b,
+                                                       const double c) {
+        std::vector<std::pair<double, double>> res;
+        const int size = polygon.size();
+
+        for (int i = 0; i < size; i++) {
+            const auto& [x1, y1] = polygon[i];
+            const auto& [x2, y2] = polygon[(i + 1) % size];
+            const double d1 = a * x1 + b * y1 - c, d2 = a * x2 + b * y2 - c;
+
+            if (d1 <= EPSILON) {
+                res.emplace_back(x1, y1);
+            }
+            if (d1 < -EPSILON && d2 > EPSILON || d1 > EPSILON && d2 < -EPSILON) {
+                const double t = d1 / (d1 - d2);
+                res.emplace_back(x1 + t * (x2 - x1), y1 + t * (y2 - y1));
+            }
+        }
+        return res;
+    }
+
+    // line within the plot
+    static std::optional<std::pair<std::pair<double, double>, std::pair<double, double>>> segment(const Constraint& constraint, const double limit) {
+        const auto& [a, b, c, sense] = constraint;
+        std::vector<std::pair<double, double>> ends;
+        auto add = [&ends, limit](const double x, const double y) -> void {
+            if (x >= -EPSILON && x <= limit + EPSILON && y >= -EPSILON && y <= limit + EPSILON) {
+                ends.emplace_back(x, y);
+            }
+        };
+        if (std::abs(b) > EPSILON) {
+            add(0, c / b);
+            add(limit, (c - a * limit) / b);
+        }
+        if (std::abs(a) > EPSILON) {
+            add(c / a, 0);
+            add((c - b * limit) / a, limit);
+        }
+        if (ends.size() < 2) {
+            return std::nullopt;
+        }
+        const auto [min, max] = std::ranges::minmax(ends);
+        return std::pair{min, max};
+    }
+
+    static void write(const Figure& figure) {
+        const double scale = (SIZE - 2 * MARGIN) / figure.limit;
+        auto x = [scale](const double value) -> double { return MARGIN + value * scale; };
+        auto y = [scale](const double value) -> double { return SIZE - MARGIN - value * scale; };
+        std::vector<std::pair<double, double>> region{{0, 0}, {figure.limit, 0}, {figure.limit, figure.limit}, {0, figure.limit}};
+
+        std::error_code error;
+
+        if (const std::filesystem::path parent = std::filesystem::path(figure.path).parent_path(); !parent.empty()) {
+            std::filesystem::create_directories(parent, error);
+        }
+        std::ofstream out(figure.path);
+
+        if (error || !out) {
+            throw std::runtime_error("cannot write " + figure.path + (error ? ": " + error.message() : ""));
+        }
+
+        for (const auto& [a, b, c, sense] : figure.constraints) {
+            if (sense <= 0) {
+                region = clip(region, a, b, c);
+            }
+            if (sense >= 0) {
+                region = clip(region, -a, -b, -c);
+            }
+        }
+        out << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << SIZE << "\" height=\"" << SIZE << "\" viewBox=\"0 0 " << SIZE << ' ' << SIZE
+            << "\">\n";
+        out << "<rect width=\"100%\" height=\"100%\" fill=\"white\"/>\n";
+
+        if (!region.empty()) {
+            out << "<polygon fill=\"#9ecae1\" fill-opacity=\"0.5\" points=\"";
+
+            for (const auto& [px, py] : region) {
+                out << x(px) << ',' << y(py) << ' ';
+            }
+            out << "\"/>\n";
+        }
+        for (int k = 0; k <= TICKS; k++) {
+            const double value = figure.limit * k / TICKS;
+            out << "<text x=\"" << x(value) << "\" y=\"" << y(0) + 16 << "\" font-size=\"11\" text-anchor=\"middle\">" << value << "</text>\n";
+            out << "<text x=\"" << x(0) - 6 << "\" y=\"" << y(value) + 4 << "\" font-size=\"11\" text-anchor=\"end\">" << value << "</text>\n";
+        }
+        out << "<line x1=\"" << x(0) << "\" y1=\"" << y(0) << "\" x2=\"" << x(figure.limit) << "\" y2=\"" << y(0) << "\" stroke=\"black\"/>\n";
+        out << "<line x1=\"" << x(0) << "\" y1=\"" << y(0) << "\" x2=\"" << x(0) << "\" y2=\"" << y(figure.limit) << "\" stroke=\"black\"/>\n";
+        const int size = figure.constraints.size();
+
+        for (int i = 0; i < size; i++) {
+            if (const auto ends = segment(figure.constraints[i], figure.limit)) {
+                const auto& [begin, end] = *ends;
+                out << "<line x1=\"" << x(begin.first) << "\" y1=\"" << y(begin.second) << "\" x2=\"" << x(end.first) << "\" y2=\"" << y(end.second)
+                    << "\" stroke=\"" << PALETTE[i % PALETTE.size()] << "\" stroke-width=\"2\"/>\n";
+            }
+        }
+        for (const auto& [px, py] : figure.points) {
+            if (px >= 0 && px <= figure.limit && py >= 0 && py <= figure.limit) {
+                out << "<circle cx=\"" << x(px) << "\" cy=\"" << y(py) << "\" r=\"3\"/>\n";
+            }
+        }
+        if (figure.optimum) {
+            out << "<circle cx=\"" << x(figure.optimum->first) << "\" cy=\"" << y(figure.optimum->second) << "\" r=\"5\" fill=\"red\"/>\n";
+        }
+        out << "</svg>\n";
+
+        if (!out.flush()) {
+            throw std::runtime_error("cannot write " + figure.path);
+        }
+    }
+
+public:
+    bool asynchronous = false; // write on a background thread
+
+    void render(Figure&& figure) {
+        if (!asynchronous) {
+            write(figure);
+            return;
+        }
+        std::lock_guard lock(mutex);
+
+        if (!worker.joinable()) {
+            worker = std::jthread([this](const std::stop_token token) -> void {
+                LOG_SUPPRESSED = true;
+
+                while (true) {
+                    Figure figure;
+                    {
+                        std::unique_lock lock(mutex);
+
+                        if (!condition.wait(lock, token, [this] -> bool { return !jobs.empty(); })) {
+                            return; // stopped with nothing left to write
+                        }
+                        figure = std::move(jobs.front());
+                        jobs.pop();
+                    }
+                    std::exception_ptr error;
+
+                    try {
+                        write(figure);
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+                    std::lock_guard lock(mutex);
+
+                    if (error && !failure) {
+                        failure = error;
+                    }
+                    pending--;
+                    idle.notify_all();
+                }
+            });
+        }
+        jobs.push(std::move(figure));
+        pending++;
+        condition.notify_one();
+    }
+
+    void wait() { // until every queued figure is written, rethrows the first failed write
+        std::unique_lock lock(mutex);
+        idle.wait(lock, [this] -> bool { return pending == 0; });
+
+        if (failure) {
+            std::rethrow_exception(std::exchange(failure, nullptr));
+        }
+    }
+};
+
+namespace optimization {
+    inline Renderer GLOBAL_RENDERER; // figures of optimize_graphical
+} // namespace optimization
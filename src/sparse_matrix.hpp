@@ -0,0 +1,85 @@
+#pragma once
+
+template <typename T>
+class optimization::SparseMatrix {
+    int row_count = 0;
+    std::vector<int> column_pointers{0}, row_indices; // compressed sparse column
+    std::vector<T> elements;
+
+    template <typename>
+    friend class SparseMatrix;
+
+public:
+    SparseMatrix() = default;
+
+    explicit SparseMatrix(const int rows) : row_count(rows) {}
+
+    explicit SparseMatrix(const Tableau<T>& tableau) : row_count(tableau.rows()) {
+        const int columns = tableau.columns();
+        column_pointers.reserve(columns + 1);
+
+        for (int j = 0; j < columns; j++) {
+            for (int i = 0; i < row_count; i++) {
+                if (tableau[i, j] != 0) {
+                    row_indices.push_back(i);
+                    elements.push_back(tableau[i, j]);
+                }
+            }
+            column_pointers.push_back(row_indices.size());
+        }
+    }
+
+    template <typename U>
+    explicit SparseMatrix(const SparseMatrix<U>& matrix) :
+        row_count(matrix.row_count), column_pointers(matrix.column_pointers), row_indices(matrix.row_indices) {
+        elements.reserve(matrix.elements.size());
+
+        for (const U& element : matrix.elements) {
+            elements.push_back(static_cast<T>(element));
+        }
+    }
+
+    int rows() const { return row_count; }
+
+    int columns() const { return column_pointers.size() - 1; }
+
+    int non_zeros() const { return elements.size(); }
+
+    std::span<const int> indices(const int column) const {
+        return std::span(row_indices).subspan(column_pointers[column], column_pointers[column + 1] - column_pointers[column]);
+    }
+
+    std::span<const T> values(const int column) const {
+        return std::span(elements).subspan(column_pointers[column], column_pointers[column + 1] - column_pointers[column]);
+    }
+
+    void push_column(const std::vector<std::pair<int, T>>& column) { // sorted by row
+        for (const auto& [row, value] : column) {
+            if (value != 0) {
+                row_indices.push_back(row);
+                elements.push_back(value);
+            }
+        }
+        column_pointers.push_back(row_indices.size());
+    }
+
+    T dot(const int column, const std::vector<T>& x) const {
+        T res = 0;
+
+        for (int k = column_pointers[column]; k < column_pointers[column + 1]; k++) {
+            if (x[row_indices[k]] != 0) {
+                res += elements[k] * x[row_indices[k]];
+            }
+        }
+        return res;
+    }
+
+    std::vector<T> scatter(const int column) const {
+        std::vector<T> res(row_count, 0);
+
+        for (int k = column_pointers[column]; k < column_pointers[column + 1]; k++) {
+            res[row_indices[k]] = elements[k];
+        }
+        return res;
+    }
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+class optimization::SymbolTable {
+    mutable std::shared_mutex mutex; // solves on branch and bound workers intern concurrently
+    struct Hash { // looks up string views without building a string
+        using is_transparent = void;
+
+        size_t operator()(const std::string_view name) const { return std::hash<std::string_view>()(name); }
+    };
+
+    std::deque<std::string> names; // stable references
+    std::unordered_map<std::string, Symbol, Hash, std::equal_to<>> symbols;
+
+public:
+    static constexpr Symbol NONE = -1;
+
+    Symbol intern(const std::string_view name) {
+        if (const Symbol symbol = find(name); symbol != NONE) {
+            return symbol;
+        }
+        std::unique_lock lock(mutex);
+        const auto [itr, inserted] = symbols.emplace(name, names.size());
+
+        if (inserted) {
+            names.emplace_back(name);
+        }
+        return itr->second;
+    }
+
+    Symbol intern(const algebra::Variable& variable) {
+        return intern(variable.variables.empty() ? std::string_view() : std::string_view(variable.variables[0].name));
+    }
+
+    Symbol find(const std::string_view name) const {
+        std::shared_lock lock(mutex);
+        const auto itr = symbols.find(name);
+        return itr != symbols.end() ? itr->second : NONE;
+    }
+
+    Symbol find(const algebra::Variable& variable) const {
+        return variable.variables.empty() ? NONE : find(std::string_view(variable.variables[0].name));
+    }
+
+    const std::string& name(const Symbol symbol) const {
+        std::shared_lock lock(mutex);
+        return names[symbol];
+    }
+
+    int size() const {
+        std::shared_lock lock(mutex);
+        return names.size();
+    }
+};
+
+namespace optimization {
+    inline SymbolTable GLOBAL_SYMBOLS; // interned variable names, shared by every model
+} // namespace optimization
@@ -0,0 +1,95 @@
+#pragma once
+
+template <typename T>
+class optimization::Tableau {
+    int row_count = 0, column_count = 0;
+    std::vector<T> data; // row-major
+
+public:
+    Tableau() = default;
+
+    Tableau(const int rows, const int columns, const T& value = T()) :
+        row_count(rows), column_count(columns), data(static_cast<size_t>(rows) * columns, value) {}
+
+    int rows() const { return row_count; }
+
+    int columns() const { return column_count; }
+
+    T& operator[](const int row, const int column) { return data[static_cast<size_t>(row) * column_count + column]; }
+
+    const T& operator[](const int row, const int column) const { return data[static_cast<size_t>(row) * column_count + column]; }
+
+    std::vector<T> column(const int column) const {
+        std::vector<T> res;
+        res.reserve(row_count);
+
+        for (int i = 0; i < row_count; i++) {
+            res.push_back((*this)[i, column]);
+        }
+        return res;
+    }
+
+    void insert_column(const int column, const T& value = T()) {
+        std::vector<T> res;
+        res.reserve(static_cast<size_t>(row_count) * (column_count + 1));
+
+        for (int i = 0; i < row_count; i++) {
+            const auto begin = data.begin() + static_cast<ptrdiff_t>(i) * column_count;
+            res.insert(res.end(), begin, begin + column);
+            res.push_back(value);
+            res.insert(res.end(), begin + column, begin + column_count);
+        }
+        data = std::move(res);
+        column_count++;
+    }
+
+    void erase_column(const int column) {
+        int k = 0;
+
+        for (int i = 0; i < row_count; i++) {
+            for (int j = 0; j < column_count; j++) {
+                if (j != column) {
+                    data[k++] = std::move(data[static_cast<size_t>(i) * column_count + j]);
+                }
+            }
+        }
+        data.resize(k);
+        column_count--;
+    }
+
+    void push_row(const T& value = T()) {
+        data.resize(data.size() + column_count, value);
+        row_count++;
+    }
+
+    void swap_rows(const int lhs, const int rhs) {
+        if (lhs != rhs) {
+            std::swap_ranges(data.begin() + static_cast<ptrdiff_t>(lhs) * column_count, data.begin() + static_cast<ptrdiff_t>(lhs + 1) * column_count,
+                             data.begin() + static_cast<ptrdiff_t>(rhs) * column_count);
+        }
+    }
+
+    void pivot(const int row, const int column) {
+        T* const pivot_row = data.data() + static_cast<size_t>(row) * column_count;
+        const T element = pivot_row[column];
+        std::vector<int> non_zeros;
+
+        for (int j = 0; j < column_count; j++) {
+            if (pivot_row[j] != 0) {
+                pivot_row[j] /= element;
+                non_zeros.push_back(j);
+            }
+        }
+        for (int i = 0; i < row_count; i++) {
+            T* const current = data.data() + static_cast<size_t>(i) * column_count;
+            const T factor = current[column];
+
+            if (i == row || factor == 0) {
+                continue;
+            }
+            for (const int j : non_zeros) {
+                current[j] -= factor * pivot_row[j];
+            }
+        }
+    }
+};